@@ -0,0 +1,15 @@
+#include <COIL/Utility/Logger/Logger.h>
+
+#include "Mesh_Benchmark.h"
+
+/* ============================================================================
+ * --------------------------- main
+ * Runs the mesher benchmark, writing to argv[1] or Mesh_Benchmark.csv.
+ *
+ * ------ Returns ------
+ * 0 on success, 1 if the output file could not be written
+ * ============================================================================ */
+int main(int argc, char* argv[]) {
+    Coil::Logger::init_logger(Coil::log_style_t::DISABLE_LOG);
+    return Run_Mesh_Benchmark(argc > 1 ? argv[1] : MESH_BENCH_DEFAULT_OUT) ? 0 : 1;
+}
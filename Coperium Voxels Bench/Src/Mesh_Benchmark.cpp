@@ -0,0 +1,242 @@
+#include "Mesh_Benchmark.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Chunk_Mesh.h"
+#include "Voxel_Gen_Util_Func.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+//----------------------------------------------------------------------------//
+//                            ALLOCATION COUNTING                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Every form of global operator new is replaced in this executable, so
+ * allocs_per_chunk counts each heap allocation the mesher makes. Only the
+ * benchmark links these; the engine keeps the standard allocator.
+ * ============================================================================ */
+static std::atomic<size_t> heap_allocations{ 0 };
+
+static void* Counted_Alloc(std::size_t size) noexcept {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+static void* Counted_Aligned_Alloc(std::size_t size, std::align_val_t align) noexcept {
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t alignment = static_cast<std::size_t>(align);
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, alignment);
+#else
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+static void Aligned_Free(void* p) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* operator new  (std::size_t size) {
+    if (void* p = Counted_Alloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if (void* p = Counted_Alloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new  (std::size_t size, const std::nothrow_t&) noexcept { return Counted_Alloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return Counted_Alloc(size); }
+
+void* operator new  (std::size_t size, std::align_val_t align) {
+    if (void* p = Counted_Aligned_Alloc(size, align)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+    if (void* p = Counted_Aligned_Alloc(size, align)) return p;
+    throw std::bad_alloc();
+}
+void* operator new  (std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return Counted_Aligned_Alloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return Counted_Aligned_Alloc(size, align); }
+
+void operator delete  (void* p)                                         noexcept { std::free(p); }
+void operator delete[](void* p)                                         noexcept { std::free(p); }
+void operator delete  (void* p, std::size_t)                            noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t)                            noexcept { std::free(p); }
+void operator delete  (void* p, const std::nothrow_t&)                  noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&)                  noexcept { std::free(p); }
+void operator delete  (void* p, std::align_val_t)                       noexcept { Aligned_Free(p); }
+void operator delete[](void* p, std::align_val_t)                       noexcept { Aligned_Free(p); }
+void operator delete  (void* p, std::size_t, std::align_val_t)          noexcept { Aligned_Free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t)          noexcept { Aligned_Free(p); }
+void operator delete  (void* p, std::align_val_t, const std::nothrow_t&) noexcept { Aligned_Free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { Aligned_Free(p); }
+
+//----------------------------------------------------------------------------//
+//                              SYNTHETIC CHUNKS                              //
+//----------------------------------------------------------------------------//
+typedef enum bench_case_t {
+    BENCH_EMPTY         = 0,
+    BENCH_FULL          = 1,
+    BENCH_CHECKERBOARD  = 2,
+    BENCH_RANDOM        = 3,
+    BENCH_WAVE          = 4,
+    NUM_BENCH_CASES     = 5
+} bench_case_t;
+
+static const char* BENCH_CASE_NAMES[NUM_BENCH_CASES] = {
+    "empty", "full", "checkerboard", "random", "wave"
+};
+
+/* ============================================================================
+ * --------------------------- Fill_Bench_World
+ * Fills chunk (0, 0, 0) of an empty world with one synthetic case. The
+ * empty case writes a single air voxel, so there is a chunk to mesh with
+ * nothing in it. The generators report their timings on std::cout, which
+ * is pointed at stderr meanwhile so stdout stays CSV.
+ * ============================================================================ */
+static void Fill_Bench_World(World& world, bench_case_t bench_case) {
+    std::streambuf* const stdout_buf = std::cout.rdbuf(std::cerr.rdbuf());
+
+    switch (bench_case) {
+    case BENCH_EMPTY: {
+        vox_data_t air;
+        air.type  = voxel_type_t::AIR;
+        air.solid = false;
+        world.Create_Voxel(air);
+        break;
+    }
+    case BENCH_FULL:
+        generate_solid_block(world);
+        break;
+    case BENCH_CHECKERBOARD:
+        generate_checkerboard(world);
+        break;
+    case BENCH_RANDOM:
+        generate_random_block(world, 0.5f, MESH_BENCH_SEED);
+        break;
+    case BENCH_WAVE:
+        generate_blocks_wave(world, { 0, 0, 0 }, { CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z });
+        break;
+    default:
+        break;
+    }
+
+    std::cout.rdbuf(stdout_buf);
+}
+
+//----------------------------------------------------------------------------//
+//                               MESHER CONFIGS                               //
+//----------------------------------------------------------------------------//
+typedef struct bench_config_t {
+    const char*     name;
+    lod_Level_t     l_o_d;
+    bool            two_pass;
+} bench_config_t;
+
+static const bench_config_t BENCH_CONFIGS[] = {
+    { "lod1_two_pass", lod_Level_t::NORMAL, true  },
+    { "lod1_one_pass", lod_Level_t::NORMAL, false },
+    { "lod2"         , lod_Level_t::LOD_2 , true  },
+    { "lod4"         , lod_Level_t::LOD_4 , true  },
+    { "lod8"         , lod_Level_t::LOD_8 , true  },
+};
+
+/* ============================================================================
+ * --------------------------- Run_Mesh_Benchmark
+ * Builds every case with every config and format until both the minimum
+ * time and the minimum iteration count are reached, then writes a row:
+ *
+ *   case, mesher, format, iterations, chunks_per_s, faces_per_chunk,
+ *   faces_per_s, bytes_per_face, allocs_per_chunk
+ *
+ * Only the CPU half of the build runs: the mesher, slot map and direction
+ * grouping, not the upload. The first build of each row is a warm up and is
+ * not timed, so the scratch arena has settled and allocs_per_chunk should
+ * read 0. Filling each world must allocate, so a fill that counts nothing
+ * is reported on stderr as counting not working.
+ *
+ * ------ Parameters ------
+ * csv_path : Where the results are written
+ *
+ * ------ Returns ------
+ * false if the output file could not be written
+ * ============================================================================ */
+bool Run_Mesh_Benchmark(const std::string& csv_path) {
+    std::ofstream csv(csv_path, std::ios::trunc);
+    if (!csv) {
+        std::cerr << "Error: Could not open benchmark output: " << csv_path << std::endl;
+        return false;
+    }
+
+    const char* header =
+        "case,mesher,format,iterations,chunks_per_s,faces_per_chunk,"
+        "faces_per_s,bytes_per_face,allocs_per_chunk";
+    csv       << header << "\n";
+    std::cout << header << "\n";
+
+    Chunk generic_chunk;
+
+    for (int c = 0; c < NUM_BENCH_CASES; ++c) {
+        World world;
+        const size_t fill_start = heap_allocations.load(std::memory_order_relaxed);
+        Fill_Bench_World(world, static_cast<bench_case_t>(c));
+        if (heap_allocations.load(std::memory_order_relaxed) == fill_start) {
+            std::cerr << "Warning: heap allocations are not being counted" << std::endl;
+        }
+
+        for (sector_pair_t sector_pair : *world.Get_All_Sectrs()) {
+            for (chunk_pair_t chunk_pair : *sector_pair.second->Get_All_Chunks()) {
+                for (const bench_config_t& config : BENCH_CONFIGS) {
+                    for (mesh_format_t format : { mesh_format_t::PACKED_VERTEX, mesh_format_t::PACKED_FACE }) {
+                        mesh_gen_ctx_t ctx;
+                        ctx.format   = format;
+                        ctx.two_pass = config.two_pass;
+                        ctx.upload   = false;
+
+                        chunk_pair.second->Get_Chunk_Data().l_o_d = config.l_o_d;
+
+                        auto build = [&]() {
+                            chunk_pair.second->Mark_Sections_Dirty(ALL_SECTIONS);
+                            return Generate_Chunk_Mesh_At_LOD(world, sector_pair, chunk_pair, generic_chunk, ctx);
+                        };
+                        build();
+
+                        int64_t     faces       = 0;
+                        int         iterations  = 0;
+                        const size_t allocs_start = heap_allocations.load(std::memory_order_relaxed);
+                        const auto   start        = std::chrono::steady_clock::now();
+                        double       seconds      = 0.0;
+
+                        while (seconds < MESH_BENCH_MIN_SECONDS || iterations < MESH_BENCH_MIN_ITERATIONS) {
+                            faces += build();
+                            ++iterations;
+                            seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        }
+                        const size_t allocs = heap_allocations.load(std::memory_order_relaxed) - allocs_start;
+
+                        std::ostringstream row;
+                        row << BENCH_CASE_NAMES[c] << ","
+                            << config.name << ","
+                            << (format == mesh_format_t::PACKED_FACE ? "packed_face" : "packed_vertex") << ","
+                            << iterations << ","
+                            << iterations / seconds << ","
+                            << static_cast<double>(faces) / iterations << ","
+                            << faces / seconds << ","
+                            << Mesh_Bytes_Per_Face(format) << ","
+                            << static_cast<double>(allocs) / iterations << "\n";
+                        csv       << row.str();
+                        std::cout << row.str() << std::flush;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef MESH_BENCHMARK_H
+#define MESH_BENCHMARK_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <string>
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+static const std::string MESH_BENCH_DEFAULT_OUT = "Mesh_Benchmark.csv";
+
+constexpr double   MESH_BENCH_MIN_SECONDS     = 0.2;  // Minimum time spent per row
+constexpr int      MESH_BENCH_MIN_ITERATIONS  = 10;   // Minimum builds per row
+constexpr uint32_t MESH_BENCH_SEED            = 40;   // Random case is the same every run
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Headless mesher benchmark. Meshes synthetic chunks (empty, full,
+ * checkerboard, random density and wave terrain) with every mesher and mesh
+ * format, running only the CPU half of the build (no GL context needed), and
+ * writes one CSV row per combination.
+ *
+ * Run with `Coperium Voxels Bench.exe [output.csv]`. Only the CSV goes to
+ * stdout; anything else is written to stderr.
+ * ============================================================================ */
+bool Run_Mesh_Benchmark(const std::string& csv_path = MESH_BENCH_DEFAULT_OUT);
+
+#endif // !MESH_BENCHMARK_H
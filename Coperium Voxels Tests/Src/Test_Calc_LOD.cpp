@@ -0,0 +1,40 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Calc_LOD.h"
+
+#include <cmath>
+
+/* ============================================================================
+ * --------------------------- Test_Screen_Error_LOD
+ * Headless self check: cells project to exactly the tolerance at each
+ * threshold, a taller viewport pushes every threshold out in proportion,
+ * a smaller window gives a coarser level for the same chunk, and an
+ * unknown view falls back to the distance set.
+ * ============================================================================ */
+bool Test_Screen_Error_LOD() {
+    const lod_dst_set_t base;
+    const float fov   = 60.0f;
+    const float error = 4.0f;
+
+    const lod_dst_set_t small = Screen_Error_LOD_Set(base, fov, 540 , error);
+    const lod_dst_set_t large = Screen_Error_LOD_Set(base, fov, 1080, error);
+
+    bool ok = Screen_Error_LOD_Set(base, fov, 0, error) == base;
+    for (int i = 0; ok && i < static_cast<int>(lod_dst_set_t::lod_Level_t::COUNT) - 1; ++i) {
+        const float dst       = std::sqrt(large.thresholds[i]);
+        const float cell      = static_cast<float>(lod_dst_set_t::Index_Level(i + 1));
+        const float projected = cell * 1080.0f / (2.0f * dst * std::tan(glm::radians(fov) * 0.5f));
+
+        ok = std::abs(projected - error) < 1e-3f &&
+             std::abs(std::sqrt(large.thresholds[i]) - 2.0f * std::sqrt(small.thresholds[i])) < 1e-2f &&
+             small.margins[i] == base.margins[i];
+    }
+
+    // Chunk (0, 0, 0) seen from three thresholds of the large set away
+    const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(0));
+    const chunk_loc_t  chunk  = chunk_loc_t ::Compact(glm::ivec3(0));
+    const glm::vec3    camera = HALF_CHUNK + glm::vec3(std::sqrt(large.thresholds[2]) * 0.99f, 0.0f, 0.0f);
+
+    ok = ok && Compute_LOD(sector, chunk, camera, large) == lod_Level_t::LOD_4;
+    ok = ok && Compute_LOD(sector, chunk, camera, small) == lod_Level_t::LOD_8;
+    return ok;
+}
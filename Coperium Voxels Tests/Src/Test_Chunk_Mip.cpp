@@ -0,0 +1,70 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Mip.h"
+#include "WorldData/World.h"
+
+#include <random>
+
+/* ============================================================================
+ * --------------------------- Test_Chunk_Mip
+ * Headless self check: fills a random chunk, builds the pyramid, applies a
+ * batch of random incremental writes and compares every cell against a brute
+ * force count of the voxels it covers.
+ *
+ * ------ Returns ------
+ * true if every cell matches
+ * ============================================================================ */
+bool Test_Chunk_Mip() {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> channel(0, 15);
+    std::uniform_int_distribution<int> coin(0, 1);
+
+    auto random_voxel = [&](const glm::ivec3& pos) {
+        vox_data_t data;
+        data.position   = pos;
+        data.colour     = { channel(rng), channel(rng), channel(rng) };
+        data.solid      = coin(rng);
+        data.type       = data.solid ? NORMAL : AIR;
+        return Voxel(data);
+    };
+
+    voxels_t voxels(MAX_VOX_LOC);
+    for (int i = 0; i < MAX_VOX_LOC; ++i) {
+        voxel_loc_t loc = { static_cast<uint16_t>(i) };
+        voxels[i] = random_voxel({ loc.X(), loc.Y(), loc.Z() });
+    }
+
+    Chunk_Mip mip;
+    mip.Build(voxels);
+
+    std::uniform_int_distribution<int> any(0, MAX_VOX_LOC - 1);
+    for (int n = 0; n < 4096; ++n) {
+        voxel_loc_t loc = { static_cast<uint16_t>(any(rng)) };
+        glm::ivec3  pos = { loc.X(), loc.Y(), loc.Z() };
+        Voxel       old = voxels[loc.location];
+        voxels[loc.location] = random_voxel(pos);
+        mip.Apply_Write(pos, old, voxels[loc.location]);
+    }
+
+    for (int l_o_d = 2; l_o_d <= 16; l_o_d *= 2) {
+        for (int x = 0; x < CHUNK_SIZE_X; x += l_o_d) {
+            for (int y = 0; y < CHUNK_SIZE_Y; y += l_o_d) {
+                for (int z = 0; z < CHUNK_SIZE_Z; z += l_o_d) {
+                    int count = 0, r = 0, g = 0, b = 0;
+                    for (int i = 0; i < l_o_d; ++i)
+                    for (int j = 0; j < l_o_d; ++j)
+                    for (int k = 0; k < l_o_d; ++k) {
+                        const Voxel& v = voxels[voxel_loc_t::Compact({ x + i, y + j, z + k }).location];
+                        if (v.IsAir()) continue;
+                        count++; r += v.GetR(); g += v.GetG(); b += v.GetB();
+                    }
+
+                    const mip_cell_t& cell = mip.Get_Cell({ x, y, z }, l_o_d);
+                    if (cell.count != count || cell.r != r || cell.g != g || cell.b != b) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
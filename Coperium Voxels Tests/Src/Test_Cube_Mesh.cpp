@@ -0,0 +1,145 @@
+#include "Tests.h"
+#include "Compact Data/Cube Mesh/CCMS.h"
+
+#include <bitset>
+#include <cstring>
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Test_Fast_Cube_Mesh
+ * Golden check for the fast path. Builds every chunk-local position at every
+ * power-of-two scale, plus every integer and a spread of averaged colours,
+ * with both encoders and compares the vertices bit for bit. Also checks that
+ * the reference indices match the fixed quad pattern the fast path relies
+ * on.
+ *
+ * ------ Returns ------
+ * true if the vertex data is identical and the index pattern holds.
+ * ============================================================================ */
+bool Test_Fast_Cube_Mesh() {
+    std::vector<GLfloat> ref_v, fast_v;
+    std::vector<GLuint > ref_i;
+    int ref_vo = 0, ref_io = 0, fast_vo = 0;
+
+    auto emit = [&](const glm::ivec3& pos, const glm::vec3& colour, int scale) {
+        Add_Cube_Mesh     (glm::vec3(pos), colour, ref_v , ref_i, ref_vo , ref_io, ALL_FACES, scale);
+        Add_Cube_Mesh_Fast(pos           , colour, fast_v,        fast_vo,         ALL_FACES, scale);
+    };
+
+    for (int scale = 1; scale <= FAST_MAX_SCALE; scale <<= 1) {
+        for (int x = 0; x < 16; ++x)
+            for (int y = 0; y < 64; ++y)
+                for (int z = 0; z < 16; ++z)
+                    emit({ x, y, z }, glm::vec3(15.0f), scale);
+    }
+    for (int r = 0; r < 16; ++r)
+        for (int g = 0; g < 16; ++g)
+            for (int b = 0; b < 16; ++b)
+                emit({ 0, 0, 0 }, glm::vec3(r, g, b), 1);
+
+    // LOD meshes pass averaged, non-integer colours
+    for (int n = 1; n <= 64; ++n)
+        for (int c = 0; c <= 15 * n; ++c)
+            emit({ 0, 0, 0 }, glm::vec3(c / static_cast<float>(n)), 2);
+
+    for (size_t k = 0; k < ref_i.size(); ++k) {
+        const GLuint quad = static_cast<GLuint>(k / FACE_INDEX_SIZE);
+        if (ref_i[k] != FACE_INDEX_MESH[k % FACE_INDEX_SIZE] + quad * FACE_VERT_COUNT)
+            return false;
+    }
+
+    return  ref_vo == fast_vo                       &&
+            ref_v.size() == fast_v.size()           &&
+            std::memcmp(ref_v.data(), fast_v.data(), ref_v.size() * sizeof(GLfloat)) == 0;
+}
+
+/* ============================================================================
+ * --------------------------- Test_Face_Records
+ * Headless check of the CFD encoder. Expands every record on the CPU with
+ * CFD::Get_Vertex (the same maths as face.vert) and compares the positions
+ * and colours with the packed-vertex output of Add_Cube_Mesh.
+ *
+ * ------ Returns ------
+ * true if every expanded vertex matches the reference mesh.
+ * ============================================================================ */
+bool Test_Face_Records() {
+    std::vector<GLfloat> ref_v;
+    std::vector<GLuint > ref_i, records;
+
+    for (int scale = 1; scale <= FAST_MAX_SCALE; scale <<= 1) {
+        for (int x = 0; x <= 16 - scale; ++x) {
+            for (int y = 0; y <= 64 - scale; ++y) {
+                for (int z = 0; z <= 16 - scale; ++z) {
+                    const glm::vec3 colour(x % 16, y % 16, (x + z) % 16);
+                    int vo = 0, io = 0;
+
+                    ref_v.clear(); ref_i.clear(); records.clear();
+                    Add_Cube_Mesh        (glm::vec3(x, y, z), colour, ref_v, ref_i, vo, io, ALL_FACES, scale);
+                    Add_Cube_Face_Records({ x, y, z }        , colour, records, ALL_FACES, scale);
+
+                    if (records.size() != NUM_FACES * CFD::WORDS_PER_FACE) return false;
+
+                    for (int f = 0; f < NUM_FACES; ++f) {
+                        const CFD record(records[f * 2], records[f * 2 + 1]);
+                        for (int vid = 0; vid < CFD::VERTICES_PER_FACE; ++vid) {
+                            const size_t ref = (static_cast<size_t>(f) * FACE_VERT_COUNT +
+                                                FACE_INDEX_MESH[vid]) * FACE_NUM_ELEMENTS;
+                            const CLD       loc(ref_v[ref]);
+                            const glm::vec3 expanded = record.Get_Vertex(vid);
+
+                            uint32_t ref_colour;
+                            std::memcpy(&ref_colour, &ref_v[ref + 1], sizeof(ref_colour));
+
+                            if (loc.Get_X() != expanded.x ||
+                                loc.Get_Y() != expanded.y ||
+                                loc.Get_Z() != expanded.z ||
+                                ref_colour  != record.Get_Colour())
+                                return false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Test_Cube_Writers
+ * Headless check that the pointer based writers produce exactly what the
+ * appending versions do, for every face mask at every scale.
+ *
+ * ------ Returns ------
+ * true if both pairs of functions agree.
+ * ============================================================================ */
+bool Test_Cube_Writers() {
+    std::vector<GLfloat> added_v, written_v;
+    std::vector<GLuint > added_f, written_f;
+
+    for (int scale = 1; scale <= FAST_MAX_SCALE; scale <<= 1) {
+        for (int mask = 0; mask <= ALL_FACES; ++mask) {
+            const cube_faces_t flags  = static_cast<cube_faces_t>(mask);
+            const int          faces  = static_cast<int>(std::bitset<8>(mask).count());
+            const glm::ivec3   pos    = { mask % 16, mask % 64, (mask * 7) % 16 };
+            const glm::vec3    colour = { mask % 16, scale % 16, (mask + scale) % 16 };
+            int vo = 0;
+
+            added_v.clear(); added_f.clear();
+            Add_Cube_Mesh_Fast   (pos, colour, added_v, vo, flags, scale);
+            Add_Cube_Face_Records(pos, colour, added_f,     flags, scale);
+
+            written_v.assign(static_cast<size_t>(faces) * FACE_VERT_SIZE, 0.0f);
+            written_f.assign(static_cast<size_t>(faces) * CFD::WORDS_PER_FACE, 0u);
+            GLfloat* end_v = Write_Cube_Mesh_Fast   (pos, colour, written_v.data(), flags, scale);
+            GLuint*  end_f = Write_Cube_Face_Records(pos, colour, written_f.data(), flags, scale);
+
+            if (end_v != written_v.data() + written_v.size() ||
+                end_f != written_f.data() + written_f.size())
+                return false;
+            if (added_v.size() != written_v.size() || added_f != written_f ||
+                std::memcmp(added_v.data(), written_v.data(), added_v.size() * sizeof(GLfloat)) != 0)
+                return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,92 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Face_Patch.h"
+
+#include <bitset>
+#include <cstring>
+#include <random>
+
+/* ============================================================================
+ * --------------------------- Test_Face_Patching
+ * Headless self check: meshes a random section in both formats while
+ * recording slots, recolours a batch of voxels by patching the built bytes
+ * and compares the result against a full rebuild with the new colours.
+ *
+ * ------ Returns ------
+ * true if every patched mesh matches its rebuild
+ * ============================================================================ */
+bool Test_Face_Patching() {
+    constexpr int N = SECTION_SIZE_Y;   // Sections are 16 x 16 x 16
+
+    std::mt19937 rng(4321);
+    std::uniform_int_distribution<int> channel(0, 15);
+    std::uniform_int_distribution<int> coin   (0, 2);
+
+    std::vector<bool>       solid (N * N * N);
+    std::vector<glm::vec3>  colour(N * N * N);
+    auto index = [](int x, int y, int z) { return (x * N + y) * N + z; };
+    auto is_air = [&](int x, int y, int z) {
+        if (x < 0 || y < 0 || z < 0 || x >= N || y >= N || z >= N) return true;
+        return !solid[index(x, y, z)];
+    };
+
+    for (int i = 0; i < N * N * N; ++i) {
+        solid [i] = coin(rng) != 0;
+        colour[i] = glm::vec3(channel(rng), channel(rng), channel(rng));
+    }
+
+    for (mesh_format_t format : { mesh_format_t::PACKED_VERTEX, mesh_format_t::PACKED_FACE }) {
+        auto build = [&](std::vector<GLfloat>& vertex_mesh, std::vector<GLuint>& face_mesh, face_slots_t* slots) {
+            int vertex_offset = 0;
+            int faces_so_far  = 0;
+            for (int x = 0; x < N; ++x)
+            for (int y = 0; y < N; ++y)
+            for (int z = 0; z < N; ++z) {
+                if (is_air(x, y, z)) continue;
+                cube_faces_t flags = static_cast<cube_faces_t>(
+                    (is_air(x, y, z + 1) << 0) | (is_air(x, y, z - 1) << 1) |
+                    (is_air(x - 1, y, z) << 2) | (is_air(x + 1, y, z) << 3) |
+                    (is_air(x, y + 1, z) << 4) | (is_air(x, y - 1, z) << 5)
+                );
+                if (slots) Record_Face_Slot(*slots, { x, y, z }, faces_so_far, flags);
+                faces_so_far += static_cast<int>(std::bitset<8>(flags).count());
+
+                if (format == mesh_format_t::PACKED_FACE)
+                    Add_Cube_Face_Records({ x, y, z }, colour[index(x, y, z)], face_mesh, flags);
+                else
+                    Add_Cube_Mesh_Fast({ x, y, z }, colour[index(x, y, z)], vertex_mesh, vertex_offset, flags);
+            }
+        };
+
+        std::vector<GLfloat> patched_v;
+        std::vector<GLuint > patched_f;
+        face_slots_t         slots;
+        build(patched_v, patched_f, &slots);
+
+        std::uniform_int_distribution<int> any(0, N - 1);
+        face_patch_t patch;
+        for (int n = 0; n < 256; ++n) {
+            glm::ivec3 pos = { any(rng), any(rng), any(rng) };
+            colour[index(pos.x, pos.y, pos.z)] = glm::vec3(channel(rng), channel(rng), channel(rng));
+
+            if (!Build_Recolour_Patch(slots, pos, colour[index(pos.x, pos.y, pos.z)], format, patch))
+                continue;
+
+            char* dst = format == mesh_format_t::PACKED_FACE
+                ? reinterpret_cast<char*>(patched_f.data())
+                : reinterpret_cast<char*>(patched_v.data());
+            std::memcpy(dst + patch.byte_offset, patch.Get_Data(), patch.Get_Size());
+        }
+
+        std::vector<GLfloat> rebuilt_v;
+        std::vector<GLuint > rebuilt_f;
+        build(rebuilt_v, rebuilt_f, nullptr);
+
+        if (patched_v.size() != rebuilt_v.size() || patched_f.size() != rebuilt_f.size())
+            return false;
+        if (std::memcmp(patched_v.data(), rebuilt_v.data(), rebuilt_v.size() * sizeof(GLfloat)) != 0)
+            return false;
+        if (std::memcmp(patched_f.data(), rebuilt_f.data(), rebuilt_f.size() * sizeof(GLuint )) != 0)
+            return false;
+    }
+    return true;
+}
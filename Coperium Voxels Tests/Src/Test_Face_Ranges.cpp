@@ -0,0 +1,98 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Face_Ranges.h"
+
+#include <bitset>
+#include <climits>
+#include <cstring>
+#include <random>
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Test_Face_Ranges
+ * Headless self check: groups a random section in both formats, with and
+ * without depth sorting, and checks that every range holds only its
+ * direction (near to far when sorted), that face_order points at an
+ * identical copy of each input face, and that the camera test keeps the
+ * right directions from outside and all of them from inside the box.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Face_Ranges() {
+    std::mt19937 rng(2024);
+    std::uniform_int_distribution<int> coord  (0, 15);
+    std::uniform_int_distribution<int> channel(0, 15);
+    std::uniform_int_distribution<int> flags  (1, ALL_FACES);
+
+    std::vector<GLfloat> vertex_mesh;
+    std::vector<GLuint > face_mesh;
+    int vertex_offset = 0;
+    int num_faces     = 0;
+    for (int n = 0; n < 500; ++n) {
+        const glm::ivec3   pos    = { coord(rng), coord(rng), coord(rng) };
+        const glm::vec3    colour = glm::vec3(channel(rng), channel(rng), channel(rng));
+        const cube_faces_t faces  = static_cast<cube_faces_t>(flags(rng));
+
+        Add_Cube_Mesh_Fast   (pos, colour, vertex_mesh, vertex_offset, faces);
+        Add_Cube_Face_Records(pos, colour, face_mesh  , faces);
+        num_faces += static_cast<int>(std::bitset<8>(faces).count());
+    }
+
+    for (int pass = 0; pass < 4; ++pass) {
+        const mesh_format_t format = pass & 1 ? mesh_format_t::PACKED_FACE : mesh_format_t::PACKED_VERTEX;
+        const bool   depth_sort  = pass >= 2;
+        const bool   packed_face = format == mesh_format_t::PACKED_FACE;
+        const void*  in          = packed_face ? static_cast<const void*>(face_mesh  .data())
+                                               : static_cast<const void*>(vertex_mesh.data());
+        const size_t face_bytes  = packed_face ? CFD::WORDS_PER_FACE * sizeof(GLuint)
+                                               : FACE_VERT_SIZE      * sizeof(GLfloat);
+
+        std::vector<char>     out(num_faces * face_bytes);
+        std::vector<uint16_t> order;
+        face_ranges_t         ranges;
+        Group_Faces_By_Direction(in, out.data(), num_faces, format, ranges, &order, depth_sort);
+
+        int total = 0;
+        for (int d = 0; d < NUM_FACES; ++d) {
+            if (ranges.first[d] != total) return false;
+            total += ranges.count[d];
+
+            const bool positive   = d == RIGHT_SHIFT || d == TOP_SHIFT || d == FRONT_SHIFT;
+            int        last_plane = positive ? INT_MAX : INT_MIN;
+            for (int f = ranges.first[d]; f < ranges.first[d] + ranges.count[d]; ++f) {
+                const char* data = out.data() + f * face_bytes;
+                const int   dir  = packed_face
+                    ? Face_Direction(reinterpret_cast<const GLuint* >(data))
+                    : Face_Direction(reinterpret_cast<const GLfloat*>(data));
+                if (dir != d) return false;
+                if (!depth_sort) continue;
+
+                const int plane = packed_face
+                    ? Face_Plane(reinterpret_cast<const GLuint* >(data), d)
+                    : Face_Plane(reinterpret_cast<const GLfloat*>(data), d);
+                if (positive ? plane > last_plane : plane < last_plane) return false;
+                last_plane = plane;
+            }
+        }
+        if (total != num_faces) return false;
+
+        for (int f = 0; f < num_faces; ++f) {
+            if (std::memcmp(
+                out.data() + order[f] * face_bytes,
+                static_cast<const char*>(in) + f * face_bytes,
+                face_bytes) != 0) return false;
+        }
+    }
+
+    const glm::vec3 box_min(-0.5f), box_max(15.5f);
+    if (Visible_Face_Directions({ 20.0f, 8.0f, -4.0f }, box_min, box_max) !=
+        (RIGHT_FACE | TOP_FACE | BOTTOM_FACE | BACK_FACE)) return false;
+    if (Visible_Face_Directions({  8.0f, 8.0f,  8.0f }, box_min, box_max) != ALL_FACES)
+        return false;
+
+    int draw_order[NUM_FACES];
+    Face_Draw_Order(glm::normalize(glm::vec3(0.2f, -1.0f, 0.5f)), draw_order);
+    if (draw_order[0] != TOP_SHIFT || draw_order[NUM_FACES - 1] != BOTTOM_SHIFT) return false;
+
+    return true;
+}
@@ -0,0 +1,107 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Far_Terrain.h"
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Test_Far_Terrain
+ * Headless self check, no GL needed: columns read the top layer's height
+ * and average colour, a top in an unloaded chunk is kept while a removed
+ * voxel in a loaded one is not, the grid has two triangles per filled cell,
+ * sectors are only picked once far away, only scanned columns with chunks
+ * count as held (and are listed by the update that scanned them), and a
+ * heightfield round trips through a file.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Far_Terrain() {
+    World world;
+    auto set = [&](glm::ivec3 pos, glm::ivec3 colour, bool solid) {
+        world.Create_Voxel({ pos, colour, voxel_type_t::NORMAL, solid, false, rel_loc_t::WORLD_LOC });
+    };
+    set({  3, 10,  5 }, { 15,  0,  0 }, true);     // Chunk (0, 0, 0), hidden below
+    set({  3, 70,  5 }, {  0, 15,  0 }, true);     // Chunk (0, 1, 0), cell (0, 0)
+    set({  4, 70,  6 }, {  0, 15, 15 }, true);     // Same layer, averaged in
+    set({ 20,  5, 20 }, { 15,  0,  0 }, true);     // Chunk (1, 0, 1), cell (2, 2)
+
+    const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(0));
+    far_cells_t cells;
+
+    bool ok = Far_Terrain::Scan_Column(world, sector, { 0, 0 }, cells);
+    ok = ok && Far_Terrain::Scan_Column(world, sector, { 1, 1 }, cells);
+    ok = ok && cells[Far_Cell_Index(0, 0)] == far_cell_t{ 70, 0, 255, 128 };
+    ok = ok && cells[Far_Cell_Index(2, 2)] == far_cell_t{  5, 255, 0, 0 };
+    ok = ok && cells[Far_Cell_Index(1, 0)].height == FAR_TERRAIN_EMPTY;
+
+    // Two filled cells, the first corner sits on top of cell (0, 0)
+    std::vector<GLfloat> vertices;
+    std::vector<GLuint>  indices;
+    ok = ok && Far_Terrain::Build_Grid(cells, vertices, indices) == 12;
+    ok = ok && vertices.size() == static_cast<size_t>((FAR_TERRAIN_CELLS + 1) * (FAR_TERRAIN_CELLS + 1) * FAR_TERRAIN_VERT_SIZE);
+    ok = ok && vertices[0] == -0.5f && vertices[1] == 70.5f && vertices[2] == -0.5f && vertices[4] == 1.0f;
+
+    // The top of cell (0, 0) unloads and is kept; a voxel removed from a
+    // loaded chunk empties cell (2, 2)
+    world.Remove_Chunk({ 0, 64, 0 }, rel_loc_t::WORLD_LOC);
+    ok = ok && !Far_Terrain::Scan_Column(world, sector, { 0, 0 }, cells);
+    ok = ok && cells[Far_Cell_Index(0, 0)].height == 70;
+
+    set({ 20, 5, 20 }, { 0, 0, 0 }, false);
+    ok = ok && Far_Terrain::Scan_Column(world, sector, { 1, 1 }, cells);
+    ok = ok && cells[Far_Cell_Index(2, 2)].height == FAR_TERRAIN_EMPTY;
+
+    // Built on update, drawn only once far away
+    Far_Terrain terrain;
+    terrain.Mark_Dirty(sector, chunk_loc_t::Compact({ 1, 0, 1 }));
+    set({ 20, 5, 20 }, { 15, 0, 0 }, true);
+    ok = ok && !terrain.Has_Column(sector, chunk_loc_t::Compact({ 1, 0, 1 }));
+    terrain.Update(world, false, 0.0f);
+    ok = ok && terrain.Get_Stats().columns_scanned == 1 && terrain.Get_Stats().meshes_built == 1;
+    ok = ok && terrain.Get_Held_Columns().size() == 1;
+    ok = ok && terrain.Get_Held_Columns()[0].column.location == chunk_loc_t::Compact({ 1, 0, 1 }).location;
+    ok = ok &&  terrain.Has_Column(sector, chunk_loc_t::Compact({ 1, 3, 1 }));
+    ok = ok && !terrain.Has_Column(sector, chunk_loc_t::Compact({ 2, 0, 2 }));
+
+    // A column waiting to be scanned is not held, nor is one with no chunk
+    terrain.Mark_Dirty(sector, chunk_loc_t::Compact({ 1, 0, 1 }));
+    terrain.Mark_Dirty(sector, chunk_loc_t::Compact({ 2, 0, 2 }));
+    ok = ok && !terrain.Has_Column(sector, chunk_loc_t::Compact({ 1, 0, 1 }));
+    terrain.Update(world, false, 0.0f);
+    ok = ok && terrain.Get_Stats().columns_scanned == 2 && terrain.Get_Held_Columns().size() == 1;
+    ok = ok &&  terrain.Has_Column(sector, chunk_loc_t::Compact({ 1, 0, 1 }));
+    ok = ok && !terrain.Has_Column(sector, chunk_loc_t::Compact({ 2, 0, 2 }));
+    ok = ok && terrain.Select(glm::vec3(0.0f), 1000.0f) == 0 && !terrain.Is_Drawn(sector);
+    ok = ok && terrain.Select(glm::vec3(5000.0f, 0.0f, 0.0f), 1000.0f) == 1 && terrain.Is_Drawn(sector);
+
+    terrain.Update(world, false, 0.0f);
+    ok = ok && terrain.Get_Stats().columns_scanned == 0 && terrain.Get_Stats().meshes_built == 0;
+    ok = ok && terrain.Get_Held_Columns().empty();
+
+    // File round trip, and a file from another version is ignored
+    const std::filesystem::path file =
+        std::filesystem::temp_directory_path() / ("verify_" + FAR_TERRAIN_FILE);
+
+    far_sector_t written;
+    written.sector = sector_loc_t::Compact(glm::ivec3(3, 0, -2));
+    written.cells  = cells;
+    written.known_columns.set(5).set(NUM_CHUNKS_X * NUM_CHUNKS_Z - 1);
+    far_sector_t read;
+    ok = ok && Far_Terrain::Save_File(file, written) && Far_Terrain::Load_File(file, read);
+    ok = ok && read.sector.location == written.sector.location && read.cells == written.cells;
+    ok = ok && read.known_columns == written.known_columns;
+
+    {
+        std::fstream patch(file, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t stale = FAR_TERRAIN_VERSION + 1;
+        patch.seekp(sizeof(FAR_TERRAIN_MAGIC));
+        patch.write(reinterpret_cast<const char*>(&stale), sizeof(stale));
+    }
+    ok = ok && !Far_Terrain::Load_File(file, read);
+
+    std::error_code ec;
+    std::filesystem::remove(file, ec);
+    return ok;
+}
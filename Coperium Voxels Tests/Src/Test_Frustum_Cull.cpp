@@ -0,0 +1,34 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Frustum_Cull.h"
+
+#include <GLM/gtc/matrix_transform.hpp>
+
+/* ============================================================================
+ * --------------------------- Test_Frustum_Cull
+ * Headless self check: a 90 degree camera at the origin looking down -z
+ * keeps a box in front of it, rejects boxes behind, beside, above and past
+ * the far plane, and reports a box around the camera (which the old
+ * origin-behind-camera test dropped) as intersecting.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Frustum_Cull() {
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const frustum_t frustum    = Extract_Frustum(projection * view);
+
+    auto test = [&](glm::vec3 box_min, glm::vec3 box_max) {
+        return Test_Frustum_Box(frustum, box_min, box_max);
+    };
+
+    bool ok = frustum.valid;
+    ok = ok && test({ -1, -1,  -11 }, {  1,  1,   -9 }) == frustum_test_t::INSIDE;
+    ok = ok && test({ -1, -1,    5 }, {  1,  1,    7 }) == frustum_test_t::OUTSIDE;     // Behind
+    ok = ok && test({ 50, -1,  -11 }, { 52,  1,   -9 }) == frustum_test_t::OUTSIDE;     // Right
+    ok = ok && test({ -1, 50,  -11 }, {  1, 52,   -9 }) == frustum_test_t::OUTSIDE;     // Above
+    ok = ok && test({ -1, -1, -210 }, {  1,  1, -200 }) == frustum_test_t::OUTSIDE;     // Past far
+    ok = ok && test({ -1, -1,   -1 }, {  1,  1,    1 }) == frustum_test_t::INTERSECTS;  // Around the camera
+    ok = ok && test({  5, -1,  -11 }, { 15,  1,   -9 }) == frustum_test_t::INTERSECTS;  // Across the right plane
+    return ok;
+}
@@ -0,0 +1,70 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/HLOD_Groups.h"
+
+/* ============================================================================
+ * --------------------------- Test_HLOD_Groups
+ * Headless self check, no GL needed: three voxels in an L across two chunks
+ * merge into one group with the shared faces dropped, the transform puts
+ * coarse cells back on their voxels, unchanged cells are not re-uploaded
+ * and groups are only built once they are far away.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_HLOD_Groups() {
+    World world;
+    auto add = [&](glm::ivec3 pos) {
+        world.Create_Voxel({ pos, glm::ivec3(10, 5, 0), voxel_type_t::NORMAL, true, false, rel_loc_t::WORLD_LOC });
+    };
+    add({  0,  0, 0 });     // Chunk (0, 0, 0), cell (0, 0, 0)
+    add({ 16,  0, 0 });     // Chunk (1, 0, 0), cell (1, 0, 0)
+    add({  0, 20, 0 });     // Chunk (0, 0, 0), cell (0, 1, 0)
+
+    const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(0));
+    const glm::ivec3   group  = glm::ivec3(0);
+    mesh_scratch_t&    scratch = Get_Mesh_Scratch();
+
+    // Three cubes sharing two faces
+    int      members   = 0;
+    uint64_t signature = 0;
+    bool ok = HLOD_Groups::Build_Group(world, sector, group, mesh_format_t::PACKED_FACE, scratch, &members, &signature) == 14;
+    ok = ok && members == 2 && scratch.face_mesh.size() == 14 * CFD::WORDS_PER_FACE;
+    ok = ok && HLOD_Groups::Build_Group(world, sector, group, mesh_format_t::PACKED_VERTEX, scratch) == 14;
+    ok = ok && scratch.vertex_mesh.size() == 14 * FACE_VERT_SIZE;
+
+    // Chunks below 0 start their own groups
+    ok = ok && HLOD_Groups::Group_Of(chunk_loc_t::Compact({ 9,  -1, 3 })) == glm::ivec3(1, -1, 0);
+    ok = ok && HLOD_Groups::Group_Of(chunk_loc_t::Compact({ 0, -17, 0 })) == glm::ivec3(0, -2, 0);
+    ok = ok && HLOD_Groups::Group_Of(chunk_loc_t::Compact({ 0,  16, 0 })) == glm::ivec3(0,  1, 0);
+
+    // Cell (1, 0, 0) covers voxels 16 .. 31, so spans 15.5 .. 31.5
+    const glm::mat4 transform = HLOD_Groups::Group_Transform(sector, group);
+    const glm::vec3 low  = glm::vec3(transform * glm::vec4(0.5f, -0.5f, -0.5f, 1.0f));
+    const glm::vec3 high = glm::vec3(transform * glm::vec4(1.5f,  0.5f,  0.5f, 1.0f));
+    ok = ok && low  == glm::vec3(15.5f, -0.5f, -0.5f) && high == glm::vec3(31.5f, 15.5f, 15.5f);
+
+    // Built only once far enough, and not rebuilt when nothing changed
+    mesh_gen_ctx_t ctx;
+    ctx.format = mesh_format_t::PACKED_FACE;
+    ctx.upload = false;
+
+    HLOD_Groups groups;
+    groups.Mark_Dirty(sector, chunk_loc_t::Compact({ 0, 0, 0 }));
+    groups.Rebuild(world, ctx, glm::vec3(0.0f), 1000.0f, 0.0f);
+    ok = ok && groups.Get_Stats().groups_built == 0 && groups.Get_Stats().groups == 1;
+
+    const glm::vec3 far_camera(5000.0f, 0.0f, 0.0f);
+    groups.Rebuild(world, ctx, far_camera, 1000.0f, 0.0f);
+    ok = ok && groups.Get_Stats().groups_built == 1 && groups.Get_Stats().groups_pending == 0;
+    groups.Rebuild(world, ctx, far_camera, 1000.0f, 0.0f);
+    ok = ok && groups.Get_Stats().groups_built == 0;
+
+    // A new voxel in the group makes it dirty and changes its cells
+    add({ 40, 100, 40 });
+    groups.Mark_Dirty(sector, chunk_loc_t::Compact({ 2, 1, 2 }));
+    groups.Rebuild(world, ctx, far_camera, 1000.0f, 0.0f);
+    ok = ok && groups.Get_Stats().groups_built == 1;
+    ok = ok && HLOD_Groups::Build_Group(world, sector, group, mesh_format_t::PACKED_FACE, scratch, &members) == 20 && members == 3;
+
+    return ok;
+}
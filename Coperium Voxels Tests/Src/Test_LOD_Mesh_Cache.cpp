@@ -0,0 +1,83 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/LOD_Mesh_Cache.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Chunk_Mesh.h"
+
+/* ============================================================================
+ * --------------------------- Test_LOD_Mesh_Cache
+ * Headless self check with meshes that own no GL objects: a LOD flip and
+ * back swaps meshes instead of rebuilding, a stale key is refused, the
+ * budget evicts the least recently used chunk first, and dropping a chunk
+ * frees what it parked at every LOD.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_LOD_Mesh_Cache() {
+    const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(0));
+    const chunk_loc_t  loc_a  = chunk_loc_t::Compact(glm::ivec3(0, 0, 0));
+    const chunk_loc_t  loc_b  = chunk_loc_t::Compact(glm::ivec3(1, 0, 0));
+
+    // Stands in for a build: every section gets `faces` faces
+    auto build = [](Chunk& chunk, lod_Level_t l_o_d, int faces, uint64_t key) {
+        chunk_data_t& data = chunk.Get_Chunk_Data();
+        for (int s = 0; s < NUM_SECTIONS; ++s) {
+            chunk.Finish_Mesh(s, mesh_format_t::PACKED_FACE, faces);
+        }
+        chunk.Swap_Meshes();
+        data.l_o_d       = l_o_d;
+        data.mesh_lod    = l_o_d;
+        data.mesh_key    = key;
+        data.mesh_voxels = 7;
+    };
+    const size_t face_bytes = Mesh_Bytes_Per_Face(mesh_format_t::PACKED_FACE) * NUM_SECTIONS;
+
+    LOD_Mesh_Cache cache;
+    cache.Set_Budget(1 << 20);
+
+    Chunk a;
+    build(a, lod_Level_t::LOD_2, 10, 111);
+
+    // LOD_2 -> LOD_4: the LOD_2 mesh is parked and a new one built
+    a.Get_Chunk_Data().l_o_d = lod_Level_t::LOD_4;
+    bool ok = !cache.Swap_In(sector, loc_a, a, 222, mesh_format_t::PACKED_FACE);
+    cache.Park(sector, loc_a, a);
+    ok = ok && a.Get_Section_Faces(0) == 0 && a.Get_Chunk_Data().mesh_key == 0;
+    ok = ok && cache.Get_Stats().bytes == 10 * face_bytes;
+    build(a, lod_Level_t::LOD_4, 20, 222);
+
+    // LOD_4 -> LOD_2: swapped back in, the LOD_4 mesh parked in its place
+    a.Get_Chunk_Data().l_o_d = lod_Level_t::LOD_2;
+    ok = ok && !cache.Swap_In(sector, loc_a, a, 333, mesh_format_t::PACKED_FACE);  // Stale
+    ok = ok &&  cache.Swap_In(sector, loc_a, a, 111, mesh_format_t::PACKED_FACE);
+    ok = ok && a.Get_Section_Faces(0) == 10 && a.Get_Chunk_Data().mesh_lod == lod_Level_t::LOD_2;
+    ok = ok && cache.Get_Stats().hits == 1 && cache.Get_Stats().bytes == 20 * face_bytes;
+
+    a.Get_Chunk_Data().l_o_d = lod_Level_t::LOD_4;
+    ok = ok && cache.Swap_In(sector, loc_a, a, 222, mesh_format_t::PACKED_FACE);
+    ok = ok && a.Get_Section_Faces(0) == 20 && cache.Get_Stats().bytes == 10 * face_bytes;
+
+    // Chunk b is parked after a, so a goes first when the budget shrinks
+    Chunk b;
+    build(b, lod_Level_t::LOD_8, 10, 444);
+    cache.Park(sector, loc_b, b);
+    cache.Set_Budget(15 * face_bytes);
+
+    ok = ok && cache.Get_Stats().entries == 1 && cache.Get_Stats().evicted == 1;
+    a.Get_Chunk_Data().l_o_d = lod_Level_t::LOD_2;
+    ok = ok && !cache.Swap_In(sector, loc_a, a, 111, mesh_format_t::PACKED_FACE);
+    ok = ok &&  cache.Swap_In(sector, loc_b, b, 444, mesh_format_t::PACKED_FACE);
+    ok = ok && b.Get_Section_Faces(0) == 10 && cache.Get_Stats().entries == 0;
+
+    build(a, lod_Level_t::LOD_2, 4, 555);
+    cache.Park(sector, loc_a, a);
+    build(a, lod_Level_t::LOD_4, 4, 666);
+    cache.Park(sector, loc_a, a);
+    build(b, lod_Level_t::LOD_8, 4, 777);
+    cache.Park(sector, loc_b, b);
+    ok = ok && cache.Get_Stats().entries == 3;
+    ok = ok && cache.Drop(sector, loc_a) == 2 && cache.Drop(sector, loc_a) == 0;
+    ok = ok && cache.Get_Stats().entries == 1 && cache.Get_Stats().bytes == 4 * face_bytes;
+
+    cache.Clear();
+    return ok;
+}
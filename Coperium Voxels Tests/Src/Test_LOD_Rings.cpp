@@ -0,0 +1,97 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/LOD_Rings.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Calc_LOD.h"
+
+#include <cmath>
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Test_LOD_Rings
+ * Headless self check over a 32 x 32 grid of chunks:
+ *
+ *  - A camera wandering over the grid gets exactly the LODs a full
+ *    re-evaluation of every chunk gives after each step, while evaluating
+ *    far fewer chunks.
+ *  - A camera hovering on a threshold flips a chunk every step without
+ *    margins and never with them.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_LOD_Rings() {
+    constexpr int GRID = NUM_CHUNKS_X;
+
+    const lod_dst_set_t lod_settings(
+        50.0f  * 50.0f,
+        100.0f * 100.0f,
+        200.0f * 200.0f,
+        400.0f * 400.0f
+    );
+    const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(0));
+    auto chunk_at = [](int i) {
+        return chunk_loc_t::Compact(glm::ivec3(i % GRID, 0, i / GRID));
+    };
+
+    std::vector<lod_Level_t> full (GRID * GRID, lod_Level_t::UNSET);
+    std::vector<lod_Level_t> rings(GRID * GRID, lod_Level_t::UNSET);
+
+    LOD_Rings tracker;
+    glm::vec3 camera(256.0f, 32.0f, 256.0f);
+    tracker.Move_Camera(camera);
+
+    for (int i = 0; i < GRID * GRID; ++i) {
+        float slack = 0.0f;
+        full [i] = Compute_LOD(sector, chunk_at(i), camera, lod_settings);
+        rings[i] = Compute_LOD(sector, chunk_at(i), camera, lod_settings, lod_Level_t::UNSET, &slack);
+        tracker.Push(sector, chunk_at(i), slack);
+    }
+
+    bool     ok                 = true;
+    int64_t  full_evaluations   = 0;
+    int64_t  ring_evaluations   = 0;
+    uint32_t seed               = 12345u;
+
+    for (int step = 0; ok && step < 400; ++step) {
+        seed = seed * 1664525u + 1013904223u;
+        const float angle = (seed >> 8) * (6.2831853f / 16777216.0f);
+        camera += glm::vec3(std::cos(angle), 0.0f, std::sin(angle)) * 6.0f;
+        tracker.Move_Camera(camera);
+
+        for (int i = 0; i < GRID * GRID; ++i) {
+            full[i] = Compute_LOD(sector, chunk_at(i), camera, lod_settings, full[i]);
+            ++full_evaluations;
+        }
+
+        lod_ring_entry_t entry;
+        while (tracker.Pop_Due(entry)) {
+            const int i = entry.chunk.X() + entry.chunk.Z() * GRID;
+            float slack = 0.0f;
+            rings[i] = Compute_LOD(sector, entry.chunk, camera, lod_settings, rings[i], &slack);
+            tracker.Push(sector, entry.chunk, slack);
+            ++ring_evaluations;
+        }
+
+        ok = full == rings;
+    }
+    ok = ok && ring_evaluations * 4 < full_evaluations;
+
+    // Hover on the NORMAL / LOD_2 threshold of chunk 0
+    auto flips = [&](const lod_dst_set_t& set) {
+        const glm::vec3 centre = glm::vec3(0.0f, 0.0f, 0.0f) + HALF_CHUNK;
+        lod_Level_t l_o_d   = lod_Level_t::UNSET;
+        int         changes = 0;
+        for (int step = 0; step < 20; ++step) {
+            const float     d   = 50.0f + (step % 2 ? 2.0f : -2.0f);
+            const lod_Level_t n = Compute_LOD(sector, chunk_at(0), centre + glm::vec3(d, 0.0f, 0.0f), set, l_o_d);
+            changes += n != l_o_d;
+            l_o_d    = n;
+        }
+        return changes;
+    };
+
+    lod_dst_set_t no_margins = lod_settings;
+    no_margins.Set_All_Margins(0.0f);
+
+    ok = ok && flips(lod_settings) == 1 && flips(no_margins) == 20;
+    return ok;
+}
@@ -0,0 +1,59 @@
+#include <COIL/Utility/Logger/Logger.h>
+#include <cstring>
+#include <iostream>
+
+#include "Tests.h"
+
+//----------------------------------------------------------------------------//
+//                                 TEST LIST                                  //
+//----------------------------------------------------------------------------//
+typedef struct test_case_t {
+    const char* name;
+    bool      (*run)();
+} test_case_t;
+
+static const test_case_t TESTS[] = {
+    { "Fast_Cube_Mesh"      , Test_Fast_Cube_Mesh       },
+    { "Face_Records"        , Test_Face_Records         },
+    { "Chunk_Mip"           , Test_Chunk_Mip            },
+    { "Face_Patching"       , Test_Face_Patching        },
+    { "Cube_Writers"        , Test_Cube_Writers         },
+    { "Mesh_Cache"          , Test_Mesh_Cache           },
+    { "Face_Ranges"         , Test_Face_Ranges          },
+    { "LOD_Rings"           , Test_LOD_Rings            },
+    { "LOD_Mesh_Cache"      , Test_LOD_Mesh_Cache       },
+    { "HLOD_Groups"         , Test_HLOD_Groups          },
+    { "Screen_Error_LOD"    , Test_Screen_Error_LOD     },
+    { "Far_Terrain"         , Test_Far_Terrain          },
+    { "Frustum_Cull"        , Test_Frustum_Cull         },
+    { "Occlusion_Cull"      , Test_Occlusion_Cull       },
+    { "Mesh_Arena"          , Test_Mesh_Arena           },
+    { "Render_Queue"        , Test_Render_Queue         },
+    { "Mesh_Swap"           , Test_Mesh_Swap            },
+};
+
+/* ============================================================================
+ * --------------------------- main
+ * Runs every test, or only those whose name contains argv[1], and prints
+ * one line per test.
+ *
+ * ------ Returns ------
+ * The number of tests that failed, so a failure fails the build
+ * ============================================================================ */
+int main(int argc, char* argv[]) {
+    Coil::Logger::init_logger(Coil::log_style_t::DISABLE_LOG);
+
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int ran    = 0;
+    int failed = 0;
+    for (const test_case_t& test : TESTS) {
+        if (filter && !std::strstr(test.name, filter)) continue;
+
+        const bool passed = test.run();
+        std::cout << (passed ? "[PASS] " : "[FAIL] ") << test.name << std::endl;
+        failed += passed ? 0 : 1;
+        ++ran;
+    }
+    std::cout << ran - failed << " / " << ran << " tests passed" << std::endl;
+    return failed;
+}
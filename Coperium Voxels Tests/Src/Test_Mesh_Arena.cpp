@@ -0,0 +1,91 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Mesh_Arena.h"
+
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Test_Mesh_Arena
+ * Headless self check of the parts that need no GL: best fit allocation,
+ * merging on free, defragmenting, growing, and the indirect commands built
+ * for a section with and without direction culling and ordering, in both
+ * mesh formats.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Mesh_Arena() {
+    Arena_Allocator allocator;
+    uint32_t a = 0, b = 0, c = 0, d = 0;
+
+    allocator.Reset(100);
+    bool ok = allocator.Allocate(10, a) && allocator.Allocate(20, b) && allocator.Allocate(30, c);
+    ok = ok && a == 0 && b == 10 && c == 30 && allocator.Get_Used() == 60;
+
+    // The 20 unit gap is the best fit for 15, not the 40 at the end
+    allocator.Free(b);
+    ok = ok && allocator.Get_Free_Blocks() == 2;
+    ok = ok && allocator.Allocate(15, d) && d == 10;
+    ok = ok && !allocator.Allocate(50, b) && allocator.Get_Largest_Free() == 40;
+
+    // Packing leaves one free block of 55 at the end
+    allocator.Free(a);
+    std::vector<arena_move_t> moves;
+    allocator.Defragment(moves);
+    ok = ok && moves.size() == 2;
+    ok = ok && moves[0].from == 10 && moves[0].to ==  0 && moves[0].size == 15;
+    ok = ok && moves[1].from == 30 && moves[1].to == 15 && moves[1].size == 30;
+    ok = ok && allocator.Get_Free_Blocks() == 1 && allocator.Get_Largest_Free() == 55;
+    ok = ok && allocator.Allocate(50, b) && b == 45;
+
+    // Freeing the middle block last joins all three
+    allocator.Reset(30);
+    ok = ok && allocator.Allocate(10, a) && allocator.Allocate(10, b) && allocator.Allocate(10, c);
+    allocator.Free(a);
+    allocator.Free(c);
+    allocator.Free(b);
+    ok = ok && allocator.Get_Free_Blocks() == 1 && allocator.Get_Largest_Free() == 30;
+
+    allocator.Reset(10);
+    ok = ok && allocator.Allocate(10, a);
+    allocator.Grow(20);
+    ok = ok && allocator.Allocate(10, b) && b == 10 && allocator.Get_Capacity() == 20;
+
+    // FRONT 3, BACK 2, RIGHT 4, TOP 1
+    face_ranges_t ranges;
+    ranges.first[FRONT_SHIFT] = 0;  ranges.count[FRONT_SHIFT] = 3;
+    ranges.first[BACK_SHIFT ] = 3;  ranges.count[BACK_SHIFT ] = 2;
+    ranges.first[LEFT_SHIFT ] = 5;
+    ranges.first[RIGHT_SHIFT] = 5;  ranges.count[RIGHT_SHIFT] = 4;
+    ranges.first[TOP_SHIFT  ] = 9;  ranges.count[TOP_SHIFT  ] = 1;
+    ranges.first[BOTTOM_SHIFT] = 10;
+
+    std::vector<draw_elements_command_t> commands;
+    int faces = Mesh_Arena::Append_Section_Commands(100, 10, ranges, ALL_FACES, nullptr, 7, commands);
+    ok = ok && faces == 10 && commands.size() == 1;
+    ok = ok && commands[0].count == 60 && commands[0].first_index == 0;
+    ok = ok && commands[0].base_vertex == 400 && commands[0].base_instance == 7;
+    ok = ok && commands[0].instance_count == 1;
+
+    commands.clear();
+    faces = Mesh_Arena::Append_Section_Commands(100, 10, ranges, FRONT_FACE | BACK_FACE | TOP_FACE, nullptr, 2, commands);
+    ok = ok && faces == 6 && commands.size() == 2;
+    ok = ok && commands[0].count == 30 && commands[0].first_index ==  0;
+    ok = ok && commands[1].count ==  6 && commands[1].first_index == 54;
+
+    // TOP first, then FRONT and BACK still merge
+    const int order[NUM_FACES] = { TOP_SHIFT, FRONT_SHIFT, BACK_SHIFT, LEFT_SHIFT, RIGHT_SHIFT, BOTTOM_SHIFT };
+    commands.clear();
+    faces = Mesh_Arena::Append_Section_Commands(0, 10, ranges, FRONT_FACE | BACK_FACE | TOP_FACE, order, 0, commands);
+    ok = ok && faces == 6 && commands.size() == 2;
+    ok = ok && commands[0].first_index == 54 && commands[1].count == 30;
+
+    // PACKED_FACE: one instance per face, the chunk's offset from the first vertex
+    std::vector<draw_arrays_command_t> face_commands;
+    faces = Mesh_Arena::Append_Face_Commands(100, 10, ranges, FRONT_FACE | BACK_FACE | TOP_FACE, nullptr, 2, face_commands);
+    ok = ok && faces == 6 && face_commands.size() == 2;
+    ok = ok && face_commands[0].instance_count == 5 && face_commands[0].base_instance == 100;
+    ok = ok && face_commands[1].instance_count == 1 && face_commands[1].base_instance == 109;
+    ok = ok && face_commands[0].first == 12 && face_commands[0].count == 6;
+
+    return ok;
+}
@@ -0,0 +1,64 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Mesh_Cache.h"
+
+#include <filesystem>
+#include <fstream>
+
+/* ============================================================================
+ * --------------------------- Test_Mesh_Cache
+ * Headless self check: round trips a cache with every kind of section
+ * through a temporary file and checks that a stale version is rejected.
+ *
+ * ------ Returns ------
+ * true if the data read back matches what was written
+ * ============================================================================ */
+bool Test_Mesh_Cache() {
+    const std::filesystem::path file =
+        std::filesystem::temp_directory_path() / ("verify_mesh_cache" + MESH_CACHE_EXT);
+
+    mesh_cache_t written;
+    written.key    = 0x0123456789ABCDEFull;
+    written.l_o_d  = lod_Level_t::LOD_4;
+    written.format = mesh_format_t::PACKED_FACE;
+
+    for (int s = 0; s < NUM_SECTIONS; ++s) {
+        mesh_cache_section_t& section = written.sections[s];
+        section.num_faces = s * 3;
+        for (int i = 0; i < s * 3 * FACE_VERT_SIZE; ++i) section.vertex_mesh.push_back(static_cast<GLfloat>(i));
+        for (int i = 0; i < s * 3 * 2;              ++i) section.face_mesh  .push_back(static_cast<GLuint >(i * 7));
+        section.has_face_slots = s % 2 == 0;
+        if (section.has_face_slots) {
+            Record_Face_Slot(section.face_slots, { s, s, s }, 0, ALL_FACES);
+        }
+    }
+
+    mesh_cache_t read;
+    bool ok = Save_Mesh_Cache_File(file, written) && Load_Mesh_Cache_File(file, read);
+
+    ok = ok && read.key == written.key && read.l_o_d == written.l_o_d && read.format == written.format;
+    for (int s = 0; ok && s < NUM_SECTIONS; ++s) {
+        const mesh_cache_section_t& a = written.sections[s];
+        const mesh_cache_section_t& b = read   .sections[s];
+        ok = a.num_faces == b.num_faces && a.has_face_slots == b.has_face_slots &&
+             a.vertex_mesh == b.vertex_mesh && a.face_mesh == b.face_mesh &&
+             a.face_slots.size() == b.face_slots.size();
+        for (size_t i = 0; ok && i < a.face_slots.size(); ++i) {
+            ok = a.face_slots[i].voxel      == b.face_slots[i].voxel      &&
+                 a.face_slots[i].first_face == b.face_slots[i].first_face &&
+                 a.face_slots[i].faces      == b.face_slots[i].faces;
+        }
+    }
+
+    // A file from another cache version must be ignored
+    {
+        std::fstream patch(file, std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t stale = MESH_CACHE_VERSION + 1;
+        patch.seekp(sizeof(MESH_CACHE_MAGIC));
+        patch.write(reinterpret_cast<const char*>(&stale), sizeof(stale));
+    }
+    ok = ok && !Load_Mesh_Cache_File(file, read);
+
+    std::error_code ec;
+    std::filesystem::remove(file, ec);
+    return ok;
+}
@@ -0,0 +1,74 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Chunk_Mesh.h"
+
+/* ============================================================================
+ * --------------------------- Test_Mesh_Swap
+ * Headless self check of a chunk's back meshes with meshes that own no GL
+ * objects, standing in for builds by filling the back sections by hand: a
+ * build spread over several calls keeps drawing the old meshes until its
+ * last section is built and then swaps them all in at once, an edit made
+ * while it runs waits for the next build, and a restarted build or a copy
+ * of a chunk being built leaves its sections dirty and the front untouched.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Mesh_Swap() {
+    const mesh_gen_ctx_t ctx;   // No arena
+    Chunk chunk;
+
+    // Stands in for building the given sections: section s gets `faces + s` faces
+    auto build = [&](int sections, int faces) {
+        for (int s = 0; s < NUM_SECTIONS; ++s) {
+            if (!(sections & (1 << s))) continue;
+            chunk.Get_Back_Section(s).patchable = true;
+            chunk.Finish_Mesh(s, mesh_format_t::PACKED_FACE, faces + s);
+        }
+        return Finish_Chunk_Build(chunk, ctx);
+    };
+    auto front_faces = [&](int f0, int f1, int f2, int f3) {
+        return chunk.Get_Section_Faces(0) == f0 && chunk.Get_Section_Faces(1) == f1 &&
+               chunk.Get_Section_Faces(2) == f2 && chunk.Get_Section_Faces(3) == f3;
+    };
+
+    // A whole chunk build swaps in at once
+    bool ok = chunk.Take_Build_Sections(NUM_SECTIONS) == ALL_SECTIONS;
+    ok = ok && build(ALL_SECTIONS, 10);
+    ok = ok && front_faces(10, 11, 12, 13) && !chunk.Is_Building();
+    ok = ok && chunk.Get_Chunk_Data().mesh_format == mesh_format_t::PACKED_FACE;
+    ok = ok && chunk.Is_Section_Patchable(0) && chunk.Get_Back_Section(0).num_faces == 0;
+
+    // One section per call: the old meshes stay in front until the last one
+    chunk.Mark_Sections_Dirty(0b0101);
+    ok = ok && chunk.Take_Build_Sections(1) == 0b0001;
+    ok = ok && !build(0b0001, 20);
+    ok = ok && front_faces(10, 11, 12, 13) && chunk.Is_Back_Ready(0) && chunk.Is_Building();
+
+    // An edit now does not join the build
+    chunk.Mark_Sections_Dirty(0b0010);
+    ok = ok && chunk.Get_Build_Sections() == 0b0100 && chunk.Get_Dirty_Sections() == 0b0010;
+
+    // A copy rebuilds what the build had done or had left
+    Chunk copy(chunk);
+    ok = ok && !copy.Is_Building() && copy.Get_Dirty_Sections() == 0b0111;
+
+    ok = ok && chunk.Take_Build_Sections(1) == 0b0100;
+    ok = ok && build(0b0100, 20);
+    ok = ok && front_faces(20, 11, 22, 13) && !chunk.Is_Building();
+    ok = ok && chunk.Get_Dirty_Sections() == 0b0010;
+
+    // The edit is the next build; restarting it puts it back as dirty
+    ok = ok && chunk.Take_Build_Sections(1) == 0b0010 && chunk.Get_Dirty_Sections() == 0;
+    chunk.Finish_Mesh(1, mesh_format_t::PACKED_FACE, 99);
+    chunk.Restart_Build();
+    ok = ok && !chunk.Is_Building() && chunk.Get_Dirty_Sections() == 0b0010;
+    ok = ok && front_faces(20, 11, 22, 13) && chunk.Get_Back_Section(1).num_faces == 0;
+
+    // Clearing drops the fronts and the build
+    chunk.Mark_Sections_Dirty(0b1000);
+    ok = ok && chunk.Take_Build_Sections(1) == 0b0010;
+    chunk.Finish_Mesh(1, mesh_format_t::PACKED_FACE, 99);
+    chunk.Clear_Meshes();
+    ok = ok && front_faces(0, 0, 0, 0) && !chunk.Is_Building();
+    return ok && chunk.Get_Dirty_Sections() == 0b1010;
+}
@@ -0,0 +1,64 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Occlusion_Cull.h"
+
+#include <vector>
+#include <GLM/gtc/matrix_transform.hpp>
+
+/* ============================================================================
+ * --------------------------- Test_Occlusion_Cull
+ * Headless self check: a wall in front of a 90 degree camera hides a box
+ * straight behind it but not one beside it, one partly past its edge, one
+ * in front of it or one around the camera, and a solid 16^3 block gathers
+ * into one box per LOD_8 cell column, on either side of a sector border.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Occlusion_Cull() {
+    const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 2.0f, 0.1f, 1000.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    Occlusion_Culler culler;
+    culler.Begin(projection * view, glm::vec3(0.0f));
+    culler.Add_Occluder({ -5, -5, -11 }, { 5, 5, -10 });
+    culler.Build_Pyramid();
+
+    bool ok = culler.Get_Depth(OCCLUSION_WIDTH / 2, OCCLUSION_HEIGHT / 2) < 1.0f;
+    ok = ok && culler.Get_Depth(0, 0) == 1.0f;
+    ok = ok &&  culler.Is_Occluded({ -1, -1, -52 }, {  1, 1, -50 });    // Behind
+    ok = ok && !culler.Is_Occluded({ 30, -1, -52 }, { 32, 1, -50 });    // Beside
+    ok = ok && !culler.Is_Occluded({  4, -1, -52 }, { 40, 1, -50 });    // Past the edge
+    ok = ok && !culler.Is_Occluded({ -1, -1,  -6 }, {  1, 1,  -4 });    // In front
+    ok = ok && !culler.Is_Occluded({ -1, -1,  -1 }, {  1, 1,   1 });    // Around the camera
+    ok = ok && culler.Get_Stats().occluders == 1;
+    ok = ok && culler.Get_Stats().boxes_tested == 5 && culler.Get_Stats().boxes_occluded == 1;
+
+    // A solid 16^3 block: 2 x 2 columns of two full cells each
+    World world;
+    for (int x = 0; x < 16; ++x)
+        for (int y = 0; y < 16; ++y)
+            for (int z = 0; z < 16; ++z)
+                world.Create_Voxel({ { x, y, z }, glm::ivec3(8), voxel_type_t::NORMAL, true, false, rel_loc_t::WORLD_LOC });
+
+    std::vector<occluder_box_t> boxes;
+    Occlusion_Culler::Gather_Occluders(world, glm::vec3(8.0f, 40.0f, 8.0f), 100.0f, 0, boxes);
+    ok = ok && boxes.size() == 4;
+    ok = ok && !boxes.empty() && boxes[0].box_max - boxes[0].box_min == glm::vec3(8.0f, 16.0f, 8.0f);
+
+    Occlusion_Culler::Gather_Occluders(world, glm::vec3(8.0f, 40.0f, 8.0f), 100.0f, 2, boxes);
+    ok = ok && boxes.size() == 2;
+    Occlusion_Culler::Gather_Occluders(world, glm::vec3(500.0f, 40.0f, 8.0f), 100.0f, 0, boxes);
+    ok = ok && boxes.empty();
+
+    // The same block in the sector at -x, -z is found by its chunk position
+    World border;
+    for (int x = -16; x < 0; ++x)
+        for (int y = 0; y < 16; ++y)
+            for (int z = -16; z < 0; ++z)
+                border.Create_Voxel({ { x, y, z }, glm::ivec3(8), voxel_type_t::NORMAL, true, false, rel_loc_t::WORLD_LOC });
+
+    Occlusion_Culler::Gather_Occluders(border, glm::vec3(4.0f, 40.0f, 4.0f), 100.0f, 0, boxes);
+    ok = ok && boxes.size() == 4;
+    ok = ok && !boxes.empty() && boxes[0].box_min.x < 0.0f && boxes[0].box_min.z < 0.0f;
+    return ok;
+}
@@ -0,0 +1,98 @@
+#include "Tests.h"
+#include "WorldData/Chunk_Management/Mesh Generation/Render_Queue.h"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+/* ============================================================================
+ * --------------------------- Check_Rings
+ * Every queued chunk is in the ring its box is in from `camera`, and the
+ * rings hold `expected` chunks between them.
+ * ============================================================================ */
+static bool Check_Rings(const Render_Queue& queue, const glm::vec3& camera, int expected) {
+    int count = 0;
+    for (int r = 0; r < RENDER_QUEUE_RINGS; ++r) {
+        for (const queued_chunk_t& item : queue.Get_Ring(r)) {
+            if (Render_Queue::Ring(camera, item.box_min, item.box_max) != r) return false;
+            ++count;
+        }
+    }
+    return count == expected && queue.Size() == expected;
+}
+
+/* ============================================================================
+ * --------------------------- Test_Render_Queue
+ * Headless self check: queued chunks land in the ring of their box, a
+ * small camera move leaves the rings alone while a larger one moves only
+ * the chunks whose ring changed, inserting twice keeps one entry, only
+ * Remove takes chunks out (even ones nothing else holds), and boxes holding
+ * the camera land in ring 0.
+ *
+ * ------ Returns ------
+ * true if every check passes
+ * ============================================================================ */
+bool Test_Render_Queue() {
+    std::mt19937 rng(2050);
+    std::uniform_int_distribution<int> sector_coord(-2, 2);
+    std::uniform_int_distribution<int> chunk_coord(0, NUM_CHUNKS_X - 1);
+    std::uniform_int_distribution<int> chunk_y(-2, 2);
+
+    typedef struct placed_t {
+        sector_loc_t            sector;
+        chunk_loc_t             chunk;
+        std::shared_ptr<Chunk>  ptr;
+    } placed_t;
+
+    // Distinct chunk positions only, so every insert adds an entry
+    std::vector<placed_t> placed;
+    while (placed.size() < 256) {
+        const sector_loc_t sector = sector_loc_t::Compact(glm::ivec3(sector_coord(rng), 0, sector_coord(rng)));
+        const chunk_loc_t  chunk  = chunk_loc_t::Compact(glm::ivec3(chunk_coord(rng), chunk_y(rng), chunk_coord(rng)));
+        const bool taken = std::any_of(placed.begin(), placed.end(), [&](const placed_t& p) {
+            return p.sector.location == sector.location && p.chunk.location == chunk.location;
+        });
+        if (!taken) placed.push_back({ sector, chunk, std::make_shared<Chunk>() });
+    }
+
+    glm::vec3 camera = { 8.5f, 70.0f, -3.25f };
+    Render_Queue queue;
+    queue.Move_Camera(camera);
+    for (const placed_t& p : placed) queue.Insert(p.sector, p.chunk, p.ptr);
+    queue.Insert(placed[0].sector, placed[0].chunk, placed[0].ptr);
+
+    bool ok = Check_Rings(queue, camera, static_cast<int>(placed.size()));
+
+    // Less than RENDER_QUEUE_RERING of travel keeps the rings as they were
+    const glm::vec3 start = camera;
+    camera += glm::vec3(RENDER_QUEUE_RERING * 0.5f, 0.0f, 0.0f);
+    ok = ok && queue.Move_Camera(camera) == 0 && Check_Rings(queue, start, static_cast<int>(placed.size()));
+
+    camera = glm::vec3(700.0f, 10.0f, -400.0f);
+    ok = ok && queue.Move_Camera(camera) > 0 && Check_Rings(queue, camera, static_cast<int>(placed.size()));
+
+    // Removed chunks leave at once
+    for (size_t i = 0; i < 64; ++i) {
+        ok = ok && queue.Remove(placed[i].sector, placed[i].chunk);
+    }
+    ok = ok && !queue.Remove(placed[0].sector, placed[0].chunk);
+    ok = ok && Check_Rings(queue, camera, static_cast<int>(placed.size()) - 64);
+
+    // The queue keeps its own reference, so chunks stay until removed
+    for (size_t i = 64; i < 96; ++i) placed[i].ptr.reset();
+    camera = glm::vec3(-300.0f, 40.0f, 900.0f);
+    queue.Move_Camera(camera);
+    ok = ok && Check_Rings(queue, camera, static_cast<int>(placed.size()) - 64);
+    for (int r = 0; r < RENDER_QUEUE_RINGS; ++r) {
+        for (const queued_chunk_t& item : queue.Get_Ring(r)) ok = ok && item.chunk != nullptr;
+    }
+    for (size_t i = 64; i < 96; ++i) {
+        ok = ok && queue.Remove(placed[i].sector, placed[i].chunk);
+    }
+    ok = ok && Check_Rings(queue, camera, static_cast<int>(placed.size()) - 96);
+
+    const glm::vec3 size   = { CHUNK_SIZE_X, SECTION_SIZE_Y, CHUNK_SIZE_Z };
+    const glm::vec3 around = glm::floor(camera / size) * size;
+    return ok && Render_Queue::Ring(camera, around, around + size) == 0;
+}
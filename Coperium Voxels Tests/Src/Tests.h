@@ -0,0 +1,31 @@
+#pragma once
+#ifndef TESTS_H
+#define TESTS_H
+
+//----------------------------------------------------------------------------//
+//                                   TESTS                                    //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Headless checks of the engine, run by Test_Main after the test project
+ * links. None of them needs a window or a GL context. Each returns true
+ * when every check it makes passes.
+ * ============================================================================ */
+bool Test_Fast_Cube_Mesh();
+bool Test_Face_Records();
+bool Test_Chunk_Mip();
+bool Test_Face_Patching();
+bool Test_Cube_Writers();
+bool Test_Mesh_Cache();
+bool Test_Face_Ranges();
+bool Test_LOD_Rings();
+bool Test_LOD_Mesh_Cache();
+bool Test_HLOD_Groups();
+bool Test_Screen_Error_LOD();
+bool Test_Far_Terrain();
+bool Test_Frustum_Cull();
+bool Test_Occlusion_Cull();
+bool Test_Mesh_Arena();
+bool Test_Render_Queue();
+bool Test_Mesh_Swap();
+
+#endif // !TESTS_H
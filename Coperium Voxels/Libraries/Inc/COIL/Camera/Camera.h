@@ -22,6 +22,8 @@ public:
     glm::vec3   Get_Position            ()const;
     glm::vec3   Get_Front               ()const;
     float       Get_FOV                 ()const;
+    int         Get_WindowWidth         ()const;
+    int         Get_WindowHeight        ()const;
     float       Get_Yaw                 ()const;
     float       Get_Pitch               ()const;
     float       Get_Movement_Speed      ()const;
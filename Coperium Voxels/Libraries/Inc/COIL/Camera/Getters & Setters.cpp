@@ -50,6 +50,30 @@ float Camera::Get_FOV() const {
     return fov;
 }
 
+/* ============================================================================
+ * ---------------------------- Get_WindowWidth
+ * Returns the width of the viewport the projection is built for.
+ *
+ * ------ Returns ------
+ * An integer representing the window width in pixels.
+ * ============================================================================
+ */
+int Camera::Get_WindowWidth() const {
+    return window_width;
+}
+
+/* ============================================================================
+ * ---------------------------- Get_WindowHeight
+ * Returns the height of the viewport the projection is built for.
+ *
+ * ------ Returns ------
+ * An integer representing the window height in pixels.
+ * ============================================================================
+ */
+int Camera::Get_WindowHeight() const {
+    return window_height;
+}
+
 /* ============================================================================
  * ---------------------------- Get_Yaw
  * Returns the yaw angle of the camera, representing its rotation around the y-axis.
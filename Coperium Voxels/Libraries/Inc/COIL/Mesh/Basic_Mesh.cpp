@@ -1,4 +1,6 @@
+#include <GLAD/glad.h>
 #include "Basic_Mesh.h"
+#include <utility>
 
 namespace Coil {
 
@@ -12,6 +14,7 @@ Basic_Mesh::Basic_Mesh() {
     vao = 0;
     vbo = 0;
     ebo = 0;
+    owns_ebo = true;
 
     vertex_buffer_stride    = 0;
 
@@ -21,6 +24,9 @@ Basic_Mesh::Basic_Mesh() {
 
     index_buffer_size       = 0;
     index_buffer_length     = 0;
+
+    instance_vertex_count   = 0;
+    instance_count          = 0;
 }
 
 /* ============================================================================
@@ -54,6 +60,7 @@ void Basic_Mesh::Configure_Mesh(
     Create_VAO(vao);
     Create_VBO(vbo, v, v_size, v_len);
     Create_EBO(ebo, i, i_size, i_len);
+    owns_ebo = true;
 
     vertex_buffer_stride    = v_stride;
 
@@ -114,15 +121,41 @@ void Basic_Mesh::Configure_Index_Buffer(
     const void*     i,      const GLsizei   i_size,
     const GLsizei   i_len
 ) {
-    if (ebo != 0) {
+    if (ebo != 0 && owns_ebo) {
         Delete_EBO(ebo);
     }
 
     Create_EBO(ebo, i, i_size, i_len);
+    owns_ebo = true;
 
     index_buffer_size = i_size;
     index_buffer_length = i_len;
 }
+
+/* ============================================================================
+ * ---------------------------- Use Shared Index Buffer
+ * Points the mesh at an index buffer owned by someone else (for example a
+ * Quad_Index_Buffer shared by every chunk). The mesh never deletes it.
+ *
+ * ------ Parameters ------
+ * shared_ebo   GL name of the shared element buffer.
+ * i_len        Number of indices to draw from it.
+ * ============================================================================
+ */
+void Basic_Mesh::Use_Shared_Index_Buffer(
+    const GLuint    shared_ebo,
+    const GLsizei   i_len
+) {
+    if (ebo != 0 && owns_ebo) {
+        Delete_EBO(ebo);
+    }
+
+    ebo      = shared_ebo;
+    owns_ebo = false;
+
+    index_buffer_size   = sizeof(GLuint);
+    index_buffer_length = i_len;
+}
 /* ============================================================================
  * ---------------------------- Add Vertex Set
  * Adds a vertex attribute set to the current 
@@ -196,6 +229,103 @@ void Basic_Mesh::Add_Vertex_Set(
     Unbind_VAO();
     Delete_VBO(vbo);
 }
+/* ============================================================================
+ * ---------------------------- Add Instanced Integer Set
+ * Links an integer attribute from the mesh VBO that advances once per
+ * instance rather than once per vertex. Used for vertex-pulling formats
+ * where each instance is one record expanded in the vertex shader.
+ *
+ * ------ Parameters ------
+ * index       Index of the vertex attribute in the VAO.
+ * vec_size    Number of components per attribute (e.g., 2 for uvec2).
+ * offset      Element offset of where the attribute data starts in the VBO.
+ * ============================================================================
+ */
+void Basic_Mesh::Add_Instanced_Integer_Set(
+    const GLuint    index,
+    const GLint     vec_size,
+    const GLuint    offset
+){
+    Bind_VAO(vao);
+    Link_VBO_Integer(
+        vbo,
+        index,
+        vec_size,
+        vertex_buffer_stride,
+        offset,
+        vertex_buffer_type,
+        vertex_buffer_size,
+        1
+    );
+    Unbind_VAO();
+}
+
+/* ============================================================================
+ * ---------------------------- Add Shared Instanced Set
+ * Points a float attribute at a buffer the mesh does not own, advancing
+ * once per instance, so a draw's base instance picks the element it reads.
+ * The buffer must keep its name for as long as the mesh is drawn.
+ *
+ * ------ Parameters ------
+ * buffer   Name of the shared buffer
+ * index    Attribute location
+ * vec_size Floats per element
+ * stride   Bytes between elements
+ * ============================================================================
+ */
+void Basic_Mesh::Add_Shared_Instanced_Set(
+    const GLuint    buffer,
+    const GLuint    index,
+    const GLint     vec_size,
+    const GLsizei   stride
+) const {
+    Bind_VAO(vao);
+    Bind_VBO(buffer);
+    glVertexAttribPointer(index, vec_size, GL_FLOAT, GL_FALSE, stride, nullptr);
+    glVertexAttribDivisor(index, 1);
+    glEnableVertexAttribArray(index);
+    Unbind_VBO();
+    Unbind_VAO();
+}
+
+/* ============================================================================
+ * ---------------------------- Update Vertex Data
+ * Overwrites part of the vertex buffer in place with glBufferSubData. The
+ * range must lie inside the data the mesh was configured with.
+ *
+ * ------ Parameters ------
+ * offset   Byte offset into the vertex buffer
+ * size     Number of bytes to write
+ * data     Replacement bytes
+ * ============================================================================
+ */
+void Basic_Mesh::Update_Vertex_Data(
+    const GLintptr  offset, const GLsizeiptr size,
+    const void*     data
+)const {
+    Bind_VBO(vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+    Unbind_VBO();
+}
+
+/* ============================================================================
+ * ---------------------------- Set Instanced Draw
+ * Switches Draw_Mesh to glDrawArraysInstanced. Each instance draws
+ * vertices_per_instance vertices generated from gl_VertexID.
+ *
+ * ------ Parameters ------
+ * vertices_per_instance    Vertices emitted per instance (e.g., 6 per quad).
+ * instance_count           Number of instances (records) to draw.
+ * ============================================================================
+ */
+void Basic_Mesh::Set_Instanced_Draw(
+    const GLsizei   vertices_per_instance,
+    const GLsizei   instance_count
+) {
+    instance_vertex_count   = vertices_per_instance;
+    this->instance_count    = instance_count;
+}
+
 /* ============================================================================
 * ---------------------------- Generate Mesh
 * Generates the mesh by binding the VAO and issuing the draw call.
@@ -209,7 +339,15 @@ void Basic_Mesh::Draw_Mesh(bool wireframe) const {
     }
 
     Bind_VAO(vao);
-    if (ebo != 0) {
+    if (instance_count > 0) {
+        glDrawArraysInstanced(
+            GL_TRIANGLES,
+            0,
+            instance_vertex_count,
+            instance_count
+        );
+    }
+    else if (ebo != 0) {
         Bind_EBO(ebo);
         glDrawElements(
             GL_TRIANGLES,
@@ -234,6 +372,56 @@ void Basic_Mesh::Draw_Mesh(bool wireframe) const {
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);  // Restore fill mode
     }
 }
+
+/* ============================================================================
+ * ---------------------------- Draw Mesh Range
+ * Draws part of the mesh with the GL 4.2 base instance draws. Instanced
+ * meshes start at record `first` through the base instance, and `draw`
+ * moves their first vertex to draw * vertices_per_instance, which the
+ * shader sees in gl_VertexID. Other meshes draw one instance with `draw`
+ * as the base instance, for attributes added with Add_Shared_Instanced_Set.
+ *
+ * ------ Parameters ------
+ * first    First index (indexed), instance (instanced) or vertex to draw.
+ * count    Number of indices, instances or vertices to draw.
+ * draw     Index of the draw's per draw data (0 when there is none).
+ * ============================================================================
+ */
+void Basic_Mesh::Draw_Mesh_Range(
+    const GLint     first,
+    const GLsizei   count,
+    const GLuint    draw
+) const {
+    if (count <= 0) return;
+
+    Bind_VAO(vao);
+    if (instance_count > 0) {
+        glDrawArraysInstancedBaseInstance(
+            GL_TRIANGLES,
+            static_cast<GLint>(draw) * instance_vertex_count,
+            instance_vertex_count,
+            count,
+            static_cast<GLuint>(first)
+        );
+    }
+    else if (ebo != 0) {
+        Bind_EBO(ebo);
+        glDrawElementsInstancedBaseInstance(
+            GL_TRIANGLES,
+            count,
+            GL_UNSIGNED_INT,
+            (void*)(GLintptr)(first * sizeof(GLuint)),
+            1,
+            draw
+        );
+        Unbind_EBO();
+    }
+    else {
+        glDrawArraysInstancedBaseInstance(GL_TRIANGLES, first, count, 1, draw);
+    }
+    Unbind_VAO();
+}
+
 /* ============================================================================
  * ---------------------------- Clear Mesh
  * Clears the mesh by deleting the VAO, VBO, and EBO, if they exist.
@@ -243,7 +431,8 @@ void Basic_Mesh::Draw_Mesh(bool wireframe) const {
 void Basic_Mesh::Clear_Mesh() {
     if (vao != 0) { Delete_VAO(vao);    }
     if (vbo != 0) { Delete_VBO(vbo);    }
-    if (ebo != 0) { Delete_EBO(ebo);    }
+    if (ebo != 0 && owns_ebo) { Delete_EBO(ebo); }
+    ebo = 0;
 
     vertex_buffer_size      = 0;
     vertex_buffer_length    = 0;
@@ -251,6 +440,30 @@ void Basic_Mesh::Clear_Mesh() {
 
     index_buffer_size       = 0;
     index_buffer_length     = 0;
+
+    instance_vertex_count   = 0;
+    instance_count          = 0;
+}
+
+/* ============================================================================
+ * ---------------------------- Swap
+ * Exchanges the GL objects and layout of two meshes. The destructor frees
+ * the GL objects, so meshes are moved this way rather than by copying.
+ * ============================================================================
+ */
+void Basic_Mesh::Swap(Basic_Mesh& other) {
+    std::swap(vao                   , other.vao                   );
+    std::swap(vbo                   , other.vbo                   );
+    std::swap(ebo                   , other.ebo                   );
+    std::swap(owns_ebo              , other.owns_ebo              );
+    std::swap(vertex_buffer_stride  , other.vertex_buffer_stride  );
+    std::swap(vertex_buffer_size    , other.vertex_buffer_size    );
+    std::swap(vertex_buffer_length  , other.vertex_buffer_length  );
+    std::swap(vertex_buffer_type    , other.vertex_buffer_type    );
+    std::swap(index_buffer_size     , other.index_buffer_size     );
+    std::swap(index_buffer_length   , other.index_buffer_length   );
+    std::swap(instance_vertex_count , other.instance_vertex_count );
+    std::swap(instance_count        , other.instance_count        );
 }
 
 /* ============================================================================
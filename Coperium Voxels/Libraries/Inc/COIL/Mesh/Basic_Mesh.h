@@ -35,6 +35,11 @@ public:
         const GLsizei   i_len
     );
 
+    void Use_Shared_Index_Buffer(
+        const GLuint    shared_ebo,
+        const GLsizei   i_len
+    );
+
     void Add_Vertex_Set (
         const GLuint    index,  const GLint     vec_size,
         const GLuint    offset
@@ -46,17 +51,43 @@ public:
         const GLsizei   v_len,  const GLenum    v_type
     )const;
 
+    void Add_Instanced_Integer_Set(
+        const GLuint    index,  const GLint     vec_size,
+        const GLuint    offset
+    );
+
+    void Set_Instanced_Draw(
+        const GLsizei   vertices_per_instance,
+        const GLsizei   instance_count
+    );
+
+    void Add_Shared_Instanced_Set(
+        const GLuint    buffer, const GLuint    index,
+        const GLint     vec_size,
+        const GLsizei   stride
+    )const;
+    void Update_Vertex_Data(
+        const GLintptr  offset, const GLsizeiptr size,
+        const void*     data
+    )const;
+
     void Draw_Mesh      (bool   wireframe = false) const;
+    void Draw_Mesh_Range(
+        const GLint     first,  const GLsizei   count,
+        const GLuint    draw = 0
+    ) const;
 
 
     void Clear_Mesh     ();
     void Clean_Mesh     ();
+    void Swap           (Basic_Mesh& other);
 
     ~Basic_Mesh         ();
 private:
     GLuint  vao;
     GLuint  vbo;
     GLuint  ebo;
+    bool    owns_ebo;
 
     GLsizei vertex_buffer_stride;
 
@@ -67,6 +98,9 @@ private:
     GLsizei index_buffer_size;
     GLsizei index_buffer_length;
 
+    GLsizei instance_vertex_count;
+    GLsizei instance_count;
+
 };
 
 }
@@ -18,6 +18,14 @@ void Link_VBO       (const GLuint   vbo,
                      const GLuint   offset,
                      const GLenum   type,
                      const GLsizei  type_size       );
+void Link_VBO_Integer(const GLuint  vbo,
+                     const GLuint   index,
+                     const GLint    vec_size,
+                     const GLsizei  stride,
+                     const GLuint   offset,
+                     const GLenum   type,
+                     const GLsizei  type_size,
+                     const GLuint   divisor         );
 
 // --------------------------------- Vertex Buffer Object
 void Unbind_VBO     ();
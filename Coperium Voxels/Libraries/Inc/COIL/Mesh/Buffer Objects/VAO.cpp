@@ -75,4 +75,38 @@ void Link_VBO(
     glEnableVertexAttribArray(index);
     Unbind_VBO();
 }
+/* ============================================================================
+ * --------------------------------- Link VBO Integer
+ * Links a VBO to an integer vertex attribute (read as uint/ivec in GLSL
+ * without conversion to float), with an optional instance divisor.
+ * 
+ * ------ Parameters ------
+ * vbo          The ID of the Vertex Buffer Object to link.
+ * index        The index of the generic vertex attribute to be modified.
+ * vec_size     The number of components per generic vertex attribute.
+ * stride       The element offset between consecutive vertex attributes.
+ * offset       The element offset of the first component.
+ * type         The integer data type of each component.
+ * type_size    The size in bytes of the data type.
+ * divisor      0 for per-vertex data, 1 to advance once per instance.
+ * ============================================================================
+ */
+void Link_VBO_Integer(
+    const GLuint    vbo,        const GLuint    index,
+    const GLint     vec_size,   const GLsizei   stride,
+    const GLuint    offset,     const GLenum    type,
+    const GLsizei   type_size,  const GLuint    divisor
+){
+    Bind_VBO(vbo);
+    glVertexAttribIPointer(
+        index,
+        vec_size,
+        type,
+        stride                   * type_size,
+        (void*)(GLintptr)(offset * type_size)
+    );
+    glVertexAttribDivisor(index, divisor);
+    glEnableVertexAttribArray(index);
+    Unbind_VBO();
+}
 };
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <GLAD/glad.h>
+#include "Quad_Index_Buffer.h"
+
+namespace Coil {
+
+/* ============================================================================
+ * ---------------------------- Constructor
+ * Creates an empty buffer. No GL resources are allocated until Reserve.
+ * ============================================================================
+ */
+Quad_Index_Buffer::Quad_Index_Buffer() {
+    ebo             = 0;
+    quad_capacity   = 0;
+}
+
+/* ============================================================================
+ * ---------------------------- Reserve
+ * Makes sure the buffer holds indices for at least num_quads quads. Grows by
+ * doubling so repeated small increases do not each trigger an upload.
+ *
+ * ------ Parameters ------
+ * num_quads    Number of quads that must be addressable.
+ * ============================================================================
+ */
+void Quad_Index_Buffer::Reserve(const GLsizei num_quads) {
+    if (num_quads <= quad_capacity) return;
+
+    GLsizei new_capacity = (quad_capacity > 0) ? quad_capacity : MIN_QUADS;
+    while (new_capacity < num_quads) new_capacity *= 2;
+
+    std::vector<GLuint> indices;
+    Build_Indices(indices, 0, new_capacity);
+
+    if (ebo == 0) {
+        Create_EBO(ebo, indices.data(), sizeof(GLuint), (GLsizei)indices.size());
+    }
+    else {
+        Bind_EBO(ebo);
+        glBufferData(
+            GL_ELEMENT_ARRAY_BUFFER,
+            sizeof(GLuint) * indices.size(),
+            indices.data(),
+            GL_STATIC_DRAW
+        );
+        Unbind_EBO();
+    }
+
+    quad_capacity = new_capacity;
+}
+
+/* ============================================================================
+ * ---------------------------- Get EBO
+ * Returns the GL name of the shared buffer (0 before the first Reserve).
+ * ============================================================================
+ */
+GLuint Quad_Index_Buffer::Get_EBO() const {
+    return ebo;
+}
+
+/* ============================================================================
+ * ---------------------------- Get Quad Capacity
+ * Returns the number of quads the buffer currently covers.
+ * ============================================================================
+ */
+GLsizei Quad_Index_Buffer::Get_Quad_Capacity() const {
+    return quad_capacity;
+}
+
+/* ============================================================================
+ * ---------------------------- Clear
+ * Releases the GL buffer.
+ * ============================================================================
+ */
+void Quad_Index_Buffer::Clear() {
+    if (ebo != 0) { Delete_EBO(ebo); }
+    ebo             = 0;
+    quad_capacity   = 0;
+}
+
+/* ============================================================================
+ * ---------------------------- Build Indices
+ * Writes the quad index pattern for a range of quads. Needs no GL context.
+ *
+ * ------ Parameters ------
+ * indices      Destination vector (overwritten).
+ * first_quad   Index of the first quad to emit.
+ * num_quads    Number of quads to emit.
+ * ============================================================================
+ */
+void Quad_Index_Buffer::Build_Indices(
+    std::vector<GLuint>&    indices,
+    const GLsizei           first_quad,
+    const GLsizei           num_quads
+) {
+    static constexpr GLuint QUAD_PATTERN[INDICES_PER_QUAD] = { 0, 1, 2, 0, 2, 3 };
+
+    indices.resize(static_cast<size_t>(num_quads) * INDICES_PER_QUAD);
+    for (GLsizei q = 0; q < num_quads; ++q) {
+        const GLuint base = static_cast<GLuint>(first_quad + q) * VERTICES_PER_QUAD;
+        for (GLsizei j = 0; j < INDICES_PER_QUAD; ++j) {
+            indices[static_cast<size_t>(q) * INDICES_PER_QUAD + j] = QUAD_PATTERN[j] + base;
+        }
+    }
+}
+
+/* ============================================================================
+ * ---------------------------- Destructor
+ * Releases the GL buffer if one was created.
+ * ============================================================================
+ */
+Quad_Index_Buffer::~Quad_Index_Buffer() {
+    Clear();
+}
+
+}
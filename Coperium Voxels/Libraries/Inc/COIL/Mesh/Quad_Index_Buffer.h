@@ -0,0 +1,48 @@
+#pragma once
+#ifndef COIL_QUAD_INDEX_BUFFER_H
+#define COIL_QUAD_INDEX_BUFFER_H
+
+// --------------------------------- External Includes
+#include <GLFW/glfw3.h>
+#include <vector>
+
+// --------------------------------- Internal Includes
+#include "Buffer Objects/Buffers.h"
+
+
+namespace Coil {
+
+/* ============================================================================
+ * Shared element buffer holding the quad pattern {0,1,2,0,2,3} + 4k.
+ *
+ * Every quad-based mesh can bind this one buffer instead of uploading its own
+ * indices. The buffer only ever grows; its GL name never changes, so meshes
+ * that have bound it stay valid after a resize.
+ * ============================================================================ */
+class Quad_Index_Buffer {
+public:
+    Quad_Index_Buffer();
+
+    void    Reserve         (const GLsizei  num_quads);
+    GLuint  Get_EBO         () const;
+    GLsizei Get_Quad_Capacity() const;
+    void    Clear           ();
+
+    static void Build_Indices(
+        std::vector<GLuint>&    indices,
+        const GLsizei           first_quad,
+        const GLsizei           num_quads
+    );
+
+    static constexpr GLsizei    INDICES_PER_QUAD    = 6;
+    static constexpr GLsizei    VERTICES_PER_QUAD   = 4;
+    static constexpr GLsizei    MIN_QUADS           = 4096;
+
+    ~Quad_Index_Buffer();
+private:
+    GLuint  ebo;
+    GLsizei quad_capacity;
+};
+
+}
+#endif // !COIL_QUAD_INDEX_BUFFER_H
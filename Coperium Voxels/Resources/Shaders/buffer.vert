@@ -2,12 +2,16 @@
 
 /* ============================================================================
  * --------------------------- Inputs
- * Vertex attributes: packed position, colour, and normal.
+ * Vertex attributes: packed position, colour, and normal. aChunkOffset is
+ * fed per instance from this frame's chunk origins (see Chunk_Offsets.h),
+ * picked by the draw's base instance; meshes that leave it disabled read
+ * zero and use vertex_offset instead.
  * ============================================================================
  */
 layout (location = 0) in float aPosPacked;
 layout (location = 1) in float aColorPacked;
 layout (location = 2) in float aNormalPacked;
+layout (location = 3) in vec3  aChunkOffset;
 
 /* ============================================================================
  * --------------------------- Outputs
@@ -135,7 +139,7 @@ vec4 DecodeColor(float encoded) {
  */
 void main() {
     // Decode and offset position
-    vec3 pos = DecodeValue(aPosPacked) + vertex_offset;
+    vec3 pos = DecodeValue(aPosPacked) + vertex_offset + aChunkOffset;
 
     // Decode and pass colour
     VertexColor = DecodeColor(aColorPacked);
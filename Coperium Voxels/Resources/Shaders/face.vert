@@ -0,0 +1,108 @@
+#version 330 core
+
+/* ============================================================================
+ * --------------------------- Inputs
+ * One CFD record per instance (see CFD.h):
+ *   aFace.x : local x (4) | y (6) | z (4) | face (3) | scale shift (3)
+ *   aFace.y : packed RGBA colour (CCD layout)
+ * Each instance draws 6 vertices, chosen by gl_VertexID % 6. Chunk draws
+ * start at vertex 6 * their index in chunk_offsets, so gl_VertexID / 6
+ * picks the chunk's origin; every other draw starts at 0, which is zero.
+ * ============================================================================
+ */
+layout (location = 0) in uvec2 aFace;
+
+/* ============================================================================
+ * --------------------------- Outputs
+ * Passing data to the fragment shader (same as buffer.vert).
+ * ============================================================================
+ */
+out vec3 FragPos;
+out vec3 Normal;
+out vec4 VertexColor;
+
+/* ============================================================================
+ * --------------------------- Uniforms
+ * Transformation matrices, vertex offset and this frame's chunk origins
+ * (a buffer texture, see Chunk_Offsets.h).
+ * ============================================================================
+ */
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 vertex_offset;
+uniform samplerBuffer chunk_offsets;
+
+/* ============================================================================
+ * --------------------------- Constants
+ * Face tables, matching the *_FACE_MESH templates in CCMS.h.
+ * ============================================================================
+ */
+const float COLOUR_DIVISOR = 255.0;
+
+// Triangle order within a face (FACE_INDEX_MESH)
+const uint QUAD_INDEX[6] = uint[6](0u, 1u, 2u, 0u, 2u, 3u);
+
+// Corner per face vertex as bits x | y << 1 | z << 2 (1 = +0.5 side)
+const uint FACE_CORNERS[24] = uint[24](
+    6u, 7u, 5u, 4u,     // FRONT
+    3u, 2u, 0u, 1u,     // BACK
+    2u, 6u, 4u, 0u,     // LEFT
+    7u, 3u, 1u, 5u,     // RIGHT
+    2u, 3u, 7u, 6u,     // TOP
+    4u, 5u, 1u, 0u      // BOTTOM
+);
+
+const vec3 FACE_NORMALS[6] = vec3[6](
+    vec3( 0.0,  0.0,  1.0),
+    vec3( 0.0,  0.0, -1.0),
+    vec3(-1.0,  0.0,  0.0),
+    vec3( 1.0,  0.0,  0.0),
+    vec3( 0.0,  1.0,  0.0),
+    vec3( 0.0, -1.0,  0.0)
+);
+
+/* ============================================================================
+ * --------------------------- DecodeColor
+ * Decodes a packed RGBA word into vec4.
+ * ============================================================================
+ */
+vec4 DecodeColor(uint data) {
+    float r = float((data >> 24) & 0xFFu) / COLOUR_DIVISOR;
+    float g = float((data >> 16) & 0xFFu) / COLOUR_DIVISOR;
+    float b = float((data >>  8) & 0xFFu) / COLOUR_DIVISOR;
+    float a = float((data >>  0) & 0xFFu) / COLOUR_DIVISOR;
+    return vec4(r, g, b, a);
+}
+
+/* ============================================================================
+ * --------------------------- main
+ * Entry point: expand the face record into one corner, apply transforms.
+ * Mirrors CFD::Get_Vertex on the CPU.
+ * ============================================================================
+ */
+void main() {
+    uint meta   = aFace.x;
+    vec3 local  = vec3(
+        float((meta >>  0) & 0x0Fu),
+        float((meta >>  4) & 0x3Fu),
+        float((meta >> 10) & 0x0Fu)
+    );
+    uint face   = min((meta >> 14) & 0x7u, 5u);
+    float high  = float(1u << ((meta >> 17) & 0x7u)) - 0.5;
+
+    uint corner = FACE_CORNERS[face * 4u + QUAD_INDEX[gl_VertexID % 6]];
+    vec3 pos    = local + vec3(
+        ((corner & 1u) != 0u) ? high : -0.5,
+        ((corner & 2u) != 0u) ? high : -0.5,
+        ((corner & 4u) != 0u) ? high : -0.5
+    ) + vertex_offset + texelFetch(chunk_offsets, gl_VertexID / 6).xyz;
+
+    VertexColor = DecodeColor(aFace.y);
+    Normal      = FACE_NORMALS[face];
+
+    vec4 worldPos = model * vec4(pos, 1.0);
+    FragPos = worldPos.xyz;
+
+    gl_Position = projection * view * worldPos;
+}
@@ -0,0 +1,47 @@
+#version 330 core
+
+/* ============================================================================
+ * --------------------------- Inputs
+ * Far terrain grid vertices (see Far_Terrain.h), relative to the sector:
+ * position, colour (0 .. 1) and normal, as plain floats.
+ * ============================================================================
+ */
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColour;
+layout (location = 2) in vec3 aNormal;
+
+/* ============================================================================
+ * --------------------------- Outputs
+ * Passing data to the fragment shader (same as buffer.vert).
+ * ============================================================================
+ */
+out vec3 FragPos;
+out vec3 Normal;
+out vec4 VertexColor;
+
+/* ============================================================================
+ * --------------------------- Uniforms
+ * Transformation matrices and the sector's world offset.
+ * ============================================================================
+ */
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 vertex_offset;
+
+/* ============================================================================
+ * --------------------------- main
+ * Entry point: offset the grid vertex into the world, apply transforms.
+ * ============================================================================
+ */
+void main() {
+    vec3 pos = aPos + vertex_offset;
+
+    VertexColor = vec4(aColour, 1.0);
+    Normal      = aNormal;
+
+    vec4 worldPos = model * vec4(pos, 1.0);
+    FragPos = worldPos.xyz;
+
+    gl_Position = projection * view * worldPos;
+}
@@ -156,9 +156,7 @@ public:
                             c4.g = (lerp(colA.g, colB.g) * 15) / 255;
                             c4.b = (lerp(colA.b, colB.b) * 15) / 255;
                         }
-                        auto voxel = chk_pair.second->Get_Voxel({ lx,0,lz });
-                        voxel->SetColour(c4);
-                        chk_pair.second->Get_Chunk_Data().updated = true;
+                        world.Recolour_Voxel(offset + glm::ivec3(lx, 0, lz), c4);
                     }
                 }
             }
@@ -0,0 +1,129 @@
+#include "CFD.h"
+
+// Corner of each face vertex, as bits x | y << 1 | z << 2 (1 = +0.5 side).
+// Same vertex order as the *_FACE_MESH templates in CCMS.h.
+static constexpr uint32_t FACE_CORNERS[6][4] = {
+    { 6, 7, 5, 4 },     // FRONT
+    { 3, 2, 0, 1 },     // BACK
+    { 2, 6, 4, 0 },     // LEFT
+    { 7, 3, 1, 5 },     // RIGHT
+    { 2, 3, 7, 6 },     // TOP
+    { 4, 5, 1, 0 }      // BOTTOM
+};
+
+// Triangle order within a face, same as FACE_INDEX_MESH.
+static constexpr int QUAD_INDEX[6] = { 0, 1, 2, 0, 2, 3 };
+
+/* ============================================================================
+ * --------------------------- CFD
+ * Default constructor initializing an empty record with opaque black.
+ * ============================================================================
+ */
+CFD::CFD() : meta(0), colour(0xFF) {}
+
+/* ============================================================================
+ * --------------------------- CFD
+ * Constructor from the two raw record words.
+ * ============================================================================
+ */
+CFD::CFD(uint32_t meta, uint32_t colour) : meta(meta), colour(colour) {}
+
+/* ============================================================================
+ * --------------------------- Set_Position
+ * Sets the chunk-local voxel position of the face.
+ *
+ * ------ Parameters ------
+ * x, y, z: Local voxel coordinates (x,z: 0-15, y: 0-63).
+ * ============================================================================
+ */
+void CFD::Set_Position(int x, int y, int z) {
+    meta &= ~((MASK_4_BIT << X_SHIFT) | (MASK_6_BIT << Y_SHIFT) | (MASK_4_BIT << Z_SHIFT));
+    meta |= (static_cast<uint32_t>(x) & MASK_4_BIT) << X_SHIFT;
+    meta |= (static_cast<uint32_t>(y) & MASK_6_BIT) << Y_SHIFT;
+    meta |= (static_cast<uint32_t>(z) & MASK_4_BIT) << Z_SHIFT;
+}
+
+/* ============================================================================
+ * --------------------------- Set_Face
+ * Sets the face direction (cube_faces_t shift value, 0-5).
+ * ============================================================================
+ */
+void CFD::Set_Face(int face) {
+    meta &= ~(MASK_3_BIT << F_SHIFT);
+    meta |= (static_cast<uint32_t>(face) & MASK_3_BIT) << F_SHIFT;
+}
+
+/* ============================================================================
+ * --------------------------- Set_Scale
+ * Sets the LOD scale. Must be a power of two between 1 and 16.
+ * ============================================================================
+ */
+void CFD::Set_Scale(int scale) {
+    uint32_t shift = 0;
+    while ((1 << (shift + 1)) <= scale) ++shift;
+
+    meta &= ~(MASK_3_BIT << S_SHIFT);
+    meta |= (shift & MASK_3_BIT) << S_SHIFT;
+}
+
+/* ============================================================================
+ * --------------------------- Set_Colour
+ * Sets the packed RGBA colour word (CCD layout).
+ * ============================================================================
+ */
+void CFD::Set_Colour(uint32_t packed_colour) {
+    colour = packed_colour;
+}
+
+/* ============================================================================
+ * --------------------------- Getters
+ * Decode the individual fields of the record.
+ * ============================================================================
+ */
+int CFD::Get_X() const { return static_cast<int>((meta >> X_SHIFT) & MASK_4_BIT); }
+int CFD::Get_Y() const { return static_cast<int>((meta >> Y_SHIFT) & MASK_6_BIT); }
+int CFD::Get_Z() const { return static_cast<int>((meta >> Z_SHIFT) & MASK_4_BIT); }
+
+int CFD::Get_Face () const { return static_cast<int>((meta >> F_SHIFT) & MASK_3_BIT); }
+int CFD::Get_Scale() const { return 1 << ((meta >> S_SHIFT) & MASK_3_BIT); }
+
+uint32_t CFD::Get_Colour() const { return colour; }
+uint32_t CFD::Get_Meta  () const { return meta;   }
+
+/* ============================================================================
+ * --------------------------- Get_Vertex
+ * CPU copy of the expansion done in face.vert. Returns the chunk-local
+ * position of one of the 6 vertices (two triangles) of this face.
+ *
+ * ------ Parameters ------
+ * vertex_id: 0-5, the value gl_VertexID takes within the face.
+ * ============================================================================
+ */
+glm::vec3 CFD::Get_Vertex(int vertex_id) const {
+    const uint32_t corner = FACE_CORNERS[Get_Face() % 6][QUAD_INDEX[vertex_id % VERTICES_PER_FACE]];
+    const float    high   = static_cast<float>(Get_Scale()) - 0.5f;
+
+    return glm::vec3(
+        static_cast<float>(Get_X()) + ((corner & 0x1) ? high : -0.5f),
+        static_cast<float>(Get_Y()) + ((corner & 0x2) ? high : -0.5f),
+        static_cast<float>(Get_Z()) + ((corner & 0x4) ? high : -0.5f)
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Compact_Meta
+ * Static helper that builds the meta word in one go. Used by the mesher.
+ *
+ * ------ Parameters ------
+ * x, y, z     : Local voxel coordinates.
+ * face        : Face direction (0-5).
+ * scale_shift : log2 of the LOD scale (0-4).
+ * ============================================================================
+ */
+uint32_t CFD::Compact_Meta(int x, int y, int z, int face, int scale_shift) {
+    return  ((static_cast<uint32_t>(x)           & MASK_4_BIT) << X_SHIFT) |
+            ((static_cast<uint32_t>(y)           & MASK_6_BIT) << Y_SHIFT) |
+            ((static_cast<uint32_t>(z)           & MASK_4_BIT) << Z_SHIFT) |
+            ((static_cast<uint32_t>(face)        & MASK_3_BIT) << F_SHIFT) |
+            ((static_cast<uint32_t>(scale_shift) & MASK_3_BIT) << S_SHIFT);
+}
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef CMP_FACE_DATA_H
+#define CMP_FACE_DATA_H
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+/* ============================================================================
+ * One 64-bit record per visible cube face, expanded to 6 vertices in
+ * face.vert using gl_VertexID.
+ *
+ * ------ Layout ------
+ * Word 0 (meta):
+ *   bits  0- 3  local X      (0-15)
+ *   bits  4- 9  local Y      (0-63)
+ *   bits 10-13  local Z      (0-15)
+ *   bits 14-16  face         (cube_faces_t shift: FRONT..BOTTOM)
+ *   bits 17-19  scale shift  (scale = 1 << shift, 1-16)
+ * Word 1 (colour): R<<24 | G<<16 | B<<8 | A, same as CCD.
+ * ============================================================================ */
+class CFD {
+public:
+    CFD();
+    CFD(uint32_t meta, uint32_t colour);
+
+    // --------------------------------- Setters
+    void    Set_Position    (int x, int y, int z);
+    void    Set_Face        (int face);
+    void    Set_Scale       (int scale);
+    void    Set_Colour      (uint32_t packed_colour);
+
+    // --------------------------------- Getters
+    int     Get_X           () const;
+    int     Get_Y           () const;
+    int     Get_Z           () const;
+    int     Get_Face        () const;
+    int     Get_Scale       () const;
+    uint32_t Get_Colour     () const;
+
+    uint32_t Get_Meta       () const;
+
+    // --------------------------------- Expansion (mirrors face.vert)
+    glm::vec3 Get_Vertex    (int vertex_id) const;
+
+    static uint32_t Compact_Meta(int x, int y, int z, int face, int scale_shift);
+
+    static constexpr int    VERTICES_PER_FACE   = 6;
+    static constexpr int    WORDS_PER_FACE      = 2;
+
+private:
+    uint32_t meta;
+    uint32_t colour;
+
+    // --------------------------------- SHIFT VALUES
+    static constexpr int    X_SHIFT     = 0;
+    static constexpr int    Y_SHIFT     = 4;
+    static constexpr int    Z_SHIFT     = 10;
+    static constexpr int    F_SHIFT     = 14;
+    static constexpr int    S_SHIFT     = 17;
+
+    // --------------------------------- MASK VALUES
+    static constexpr uint32_t MASK_3_BIT = 0x7;
+    static constexpr uint32_t MASK_4_BIT = 0xF;
+    static constexpr uint32_t MASK_6_BIT = 0x3F;
+};
+
+#endif // !CMP_FACE_DATA_H
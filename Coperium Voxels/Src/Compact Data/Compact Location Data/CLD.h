@@ -45,6 +45,11 @@ public:
                           const float y,
                           const float z);
 
+    // --------------------------------- INTEGER PACKING
+    static uint32_t Pack_Half_Grid( const int x,
+                                    const int y,
+                                    const int z);
+
 private:
     uint32_t data;
 
@@ -83,4 +88,37 @@ private:
 
 };
 
+/* ============================================================================
+ * --------------------------- Pack_Half_Grid
+ * Packs the position (x + 0.5, y + 0.5, z + 0.5) using only integer
+ * operations. Produces the same bits as Set_X/Set_Y/Set_Z would for those
+ * values, since every half-integer decomposes to mantissa |n + 0.5| with a
+ * fraction of exactly 16/32.
+ *
+ * ------ Parameters ------
+ * x, y, z: Integer grid coordinates (the packed value is offset by 0.5).
+ *
+ * ------ Returns ------
+ * The raw 32-bit packed location.
+ * ============================================================================
+ */
+inline uint32_t CLD::Pack_Half_Grid(const int x, const int y, const int z) {
+    constexpr uint32_t HALF = static_cast<uint32_t>(DIVISOR) >> 1;
+    constexpr uint32_t FRACTION_BITS =
+        (HALF << X_F_SHIFT) | (HALF << Y_F_SHIFT) | (HALF << Z_F_SHIFT);
+
+    // For negative n the magnitude of (n + 0.5) floors to -n - 1 == ~n
+    const uint32_t mx = static_cast<uint32_t>(x ^ (x >> 31));
+    const uint32_t my = static_cast<uint32_t>(y ^ (y >> 31));
+    const uint32_t mz = static_cast<uint32_t>(z ^ (z >> 31));
+
+    return  ((static_cast<uint32_t>(x) >> 31) << X_S_SHIFT) |
+            ((mx & MASK_4_BIT)                << X_M_SHIFT) |
+            ((static_cast<uint32_t>(y) >> 31) << Y_S_SHIFT) |
+            ((my & MASK_6_BIT)                << Y_M_SHIFT) |
+            ((static_cast<uint32_t>(z) >> 31) << Z_S_SHIFT) |
+            ((mz & MASK_4_BIT)                << Z_M_SHIFT) |
+            FRACTION_BITS;
+}
+
 #endif // !CMP_LOC_DATA_H
\ No newline at end of file
@@ -122,3 +122,250 @@ void Add_Cube_Mesh(
         );
 }
 
+
+
+//----------------------------------------------------------------------------//
+//                        INTEGER FAST PATH (TEMPLATES)                       //
+//----------------------------------------------------------------------------//
+typedef struct fast_face_vert_t {
+    int     base_x, base_y, base_z;     // Grid offset added to the voxel position
+    GLfloat normal;                     // Packed normal copied from the template
+} fast_face_vert_t;
+
+typedef struct fast_face_table_t {
+    fast_face_vert_t verts[NUM_FACES][FAST_MAX_SCALE + 1][FACE_VERT_COUNT];
+} fast_face_table_t;
+
+/* ============================================================================
+ * --------------------------- Build_Fast_Face_Table
+ * Decodes the float face templates once and stores, per face, per scale and
+ * per vertex, the integer grid offset of that corner. A template corner at
+ * +0.5 becomes (scale - 1) and one at -0.5 becomes -1, so that the packed
+ * value (pos + offset + 0.5) equals what Scale + Shift produce.
+ * ============================================================================ */
+static fast_face_table_t Build_Fast_Face_Table() {
+    const GLfloat* templates[NUM_FACES] = {
+        FRONT_FACE_MESH, BACK_FACE_MESH,
+        LEFT_FACE_MESH , RIGHT_FACE_MESH,
+        TOP_FACE_MESH  , BOTTOM_FACE_MESH
+    };
+
+    fast_face_table_t table{};
+    for (int f = 0; f < NUM_FACES; ++f) {
+        for (int s = 1; s <= FAST_MAX_SCALE; ++s) {
+            for (int v = 0; v < FACE_VERT_COUNT; ++v) {
+                const GLfloat* vert = templates[f] + v * FACE_NUM_ELEMENTS;
+                CLD loc(vert[0]);
+
+                fast_face_vert_t& out = table.verts[f][s][v];
+                out.base_x = (loc.Get_X() > 0.0f) ? s - 1 : -1;
+                out.base_y = (loc.Get_Y() > 0.0f) ? s - 1 : -1;
+                out.base_z = (loc.Get_Z() > 0.0f) ? s - 1 : -1;
+                out.normal = vert[2];
+            }
+        }
+    }
+    return table;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Fast_Face_Table
+ * Returns the lazily built template table.
+ * ============================================================================ */
+static const fast_face_table_t& Get_Fast_Face_Table() {
+    static const fast_face_table_t table = Build_Fast_Face_Table();
+    return table;
+}
+
+/* ============================================================================
+ * --------------------------- Pack_Face_Colour
+ * Packs the colour exactly as CCD::Scale does against the white template
+ * (factor 1.0 per channel), once per cube instead of once per vertex.
+ * ============================================================================ */
+static inline uint32_t Pack_Face_Colour(const glm::vec3& colour) {
+    const uint32_t r = static_cast<uint32_t>(static_cast<int>((colour.r / 16) * 255)) & 0xFF;
+    const uint32_t g = static_cast<uint32_t>(static_cast<int>((colour.g / 16) * 255)) & 0xFF;
+    const uint32_t b = static_cast<uint32_t>(static_cast<int>((colour.b / 16) * 255)) & 0xFF;
+    return (r << 24) | (g << 16) | (b << 8) | 0xFF;
+}
+
+/* ============================================================================
+ * --------------------------- Write_Face_Fast
+ * Writes one face from the precomputed table using integer packing only,
+ * into FACE_VERT_SIZE floats starting at out.
+ * ============================================================================ */
+static inline void Write_Face_Fast(
+    const fast_face_vert_t* face        ,   const glm::ivec3&       pos         ,
+    GLfloat                 colour      ,   GLfloat*                out
+) {
+    for (int v = 0; v < FACE_VERT_COUNT; ++v) {
+        const uint32_t loc = CLD::Pack_Half_Grid(
+            pos.x + face[v].base_x,
+            pos.y + face[v].base_y,
+            pos.z + face[v].base_z
+        );
+        std::memcpy(&out[v * FACE_NUM_ELEMENTS], &loc, sizeof(loc));
+        out[v * FACE_NUM_ELEMENTS + 1] = colour;
+        out[v * FACE_NUM_ELEMENTS + 2] = face[v].normal;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Add_Face_Fast
+ * Appends one face to a growing vertex vector.
+ * ============================================================================ */
+static inline void Add_Face_Fast(
+    const fast_face_vert_t* face        ,   const glm::ivec3&       pos         ,
+    GLfloat                 colour      ,   std::vector<GLfloat>&   verts       ,
+    int&                    v_offset
+) {
+    const size_t vert_start = verts.size();
+    verts.resize(vert_start + FACE_VERT_SIZE);
+    Write_Face_Fast(face, pos, colour, verts.data() + vert_start);
+    v_offset += FACE_VERT_COUNT;
+}
+
+/* ============================================================================
+ * --------------------------- Add_Cube_Mesh_Fast
+ * Integer-only equivalent of Add_Cube_Mesh for voxel-grid positions. The
+ * vertex output is bit-identical to Add_Cube_Mesh(glm::vec3(vert_pos), ...).
+ * No indices are produced: every face uses the fixed quad pattern, which is
+ * served by a shared Coil::Quad_Index_Buffer.
+ *
+ * ------ Parameters ------
+ * vert_pos        : Integer voxel position of the cube.
+ * vert_colour     : Voxel colour (0-15 per channel).
+ * vertex_mesh     : Destination vector of packed vertex floats.
+ * vertex_offset   : Reference to current vertex offset (updated).
+ * face_flags      : Bitmask selecting which faces to add.
+ * scale           : Uniform scale factor (default = 1).
+ *
+ * ------ Notes ------
+ * Scales outside 1-16 fall back to Add_Cube_Mesh, discarding its indices.
+ * ============================================================================ */
+void Add_Cube_Mesh_Fast(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    std::vector<GLfloat>&   vertex_mesh     ,   int&                    vertex_offset,
+    cube_faces_t            face_flags      ,   int                     scale
+) {
+    if (scale < 1 || scale > FAST_MAX_SCALE) {
+        std::vector<GLuint> discard_indices;
+        int                 discard_offset = 0;
+        Add_Cube_Mesh(
+            glm::vec3(vert_pos), vert_colour,
+            vertex_mesh, discard_indices,
+            vertex_offset, discard_offset,
+            face_flags, scale
+        );
+        return;
+    }
+
+    const fast_face_table_t& table = Get_Fast_Face_Table();
+
+    const uint32_t colour_bits = Pack_Face_Colour(vert_colour);
+    GLfloat colour;
+    std::memcpy(&colour, &colour_bits, sizeof(colour));
+
+    for (int f = 0; f < NUM_FACES; ++f) {
+        if (!(face_flags & (0x1 << f))) continue;
+        Add_Face_Fast(
+            table.verts[f][scale], vert_pos     ,
+            colour              , vertex_mesh   ,
+            vertex_offset
+        );
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Write_Cube_Mesh_Fast
+ * Pointer based form of Add_Cube_Mesh_Fast for the two pass mesher. The
+ * caller has already sized the buffer from the face count, so the faces are
+ * written straight into their final place with no growth checks.
+ *
+ * ------ Parameters ------
+ * vert_pos        : Integer voxel position of the cube.
+ * vert_colour     : Voxel colour (0-15 per channel).
+ * out             : Where the first selected face is written.
+ * face_flags      : Bitmask selecting which faces to write.
+ * scale           : Uniform scale factor, 1-16 (default = 1).
+ *
+ * ------ Returns ------
+ * Pointer just past the last float written.
+ * ============================================================================ */
+GLfloat* Write_Cube_Mesh_Fast(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    GLfloat*                out             ,   cube_faces_t            face_flags  ,
+    int                     scale
+) {
+    const fast_face_table_t& table = Get_Fast_Face_Table();
+
+    const uint32_t colour_bits = Pack_Face_Colour(vert_colour);
+    GLfloat colour;
+    std::memcpy(&colour, &colour_bits, sizeof(colour));
+
+    for (int f = 0; f < NUM_FACES; ++f) {
+        if (!(face_flags & (0x1 << f))) continue;
+        Write_Face_Fast(table.verts[f][scale], vert_pos, colour, out);
+        out += FACE_VERT_SIZE;
+    }
+    return out;
+}
+
+//----------------------------------------------------------------------------//
+//                        PACKED FACE RECORDS (CFD)                           //
+//----------------------------------------------------------------------------//
+
+/* ============================================================================
+ * --------------------------- Add_Cube_Face_Records
+ * Appends one 64-bit CFD record (two GLuints) per selected face. This is the
+ * vertex-pulling alternative to Add_Cube_Mesh_Fast: face.vert expands each
+ * record into the same 6 vertices the packed-vertex path would draw.
+ *
+ * ------ Parameters ------
+ * vert_pos        : Integer voxel position of the cube.
+ * vert_colour     : Voxel colour (0-15 per channel).
+ * face_mesh       : Destination vector of record words.
+ * face_flags      : Bitmask selecting which faces to add.
+ * scale           : LOD scale, a power of two from 1 to 16 (default = 1).
+ * ============================================================================ */
+void Add_Cube_Face_Records(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    std::vector<GLuint>&    face_mesh       ,   cube_faces_t            face_flags  ,
+    int                     scale
+) {
+    int scale_shift = 0;
+    while ((1 << (scale_shift + 1)) <= scale) ++scale_shift;
+
+    const GLuint colour = Pack_Face_Colour(vert_colour);
+
+    for (int f = 0; f < NUM_FACES; ++f) {
+        if (!(face_flags & (0x1 << f))) continue;
+        face_mesh.push_back(CFD::Compact_Meta(vert_pos.x, vert_pos.y, vert_pos.z, f, scale_shift));
+        face_mesh.push_back(colour);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Write_Cube_Face_Records
+ * Pointer based form of Add_Cube_Face_Records for the two pass mesher.
+ *
+ * ------ Returns ------
+ * Pointer just past the last word written.
+ * ============================================================================ */
+GLuint* Write_Cube_Face_Records(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    GLuint*                 out             ,   cube_faces_t            face_flags  ,
+    int                     scale
+) {
+    int scale_shift = 0;
+    while ((1 << (scale_shift + 1)) <= scale) ++scale_shift;
+
+    const GLuint colour = Pack_Face_Colour(vert_colour);
+
+    for (int f = 0; f < NUM_FACES; ++f) {
+        if (!(face_flags & (0x1 << f))) continue;
+        *out++ = CFD::Compact_Meta(vert_pos.x, vert_pos.y, vert_pos.z, f, scale_shift);
+        *out++ = colour;
+    }
+    return out;
+}
@@ -11,10 +11,14 @@
 #include "../Compact Location Data/CLD.h"
 #include "../Compact Colour Data/CCD.h"
 #include "../Compact Normal Data/CND.h"
+#include "../Compact Face Data/CFD.h"
 
 constexpr int FACE_INDEX_SIZE   = 6;    // number of indices per face
 constexpr int FACE_VERT_SIZE    = 12;   // x,y location + colour + normal (1 float each) => 1+1+1+1 = 4 floats per vertex; 4*3 vertices =12
 constexpr int FACE_NUM_ELEMENTS = 3;    // floats per vertex (pos, col, normal)
+constexpr int NUM_FACES         = 6;    // faces per cube
+constexpr int FACE_VERT_COUNT   = FACE_VERT_SIZE / FACE_NUM_ELEMENTS;  // vertices per face
+constexpr int FAST_MAX_SCALE    = 16;   // largest scale the fast path takes
 
 typedef enum cube_faces_t : uint8_t {
     FRONT_SHIFT  = 0,    BACK_SHIFT   = 1,
@@ -101,4 +105,28 @@ void Add_Cube_Mesh(
     cube_faces_t            face_flags      ,   int                     scale = 1
 );
 
+void Add_Cube_Mesh_Fast(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour  ,
+    std::vector<GLfloat>&   vertex_mesh     ,   int&                    vertex_offset,
+    cube_faces_t            face_flags      ,   int                     scale = 1
+);
+
+void Add_Cube_Face_Records(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    std::vector<GLuint>&    face_mesh       ,   cube_faces_t            face_flags  ,
+    int                     scale = 1
+);
+
+GLfloat* Write_Cube_Mesh_Fast(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    GLfloat*                out             ,   cube_faces_t            face_flags  ,
+    int                     scale = 1
+);
+
+GLuint* Write_Cube_Face_Records(
+    const glm::ivec3&       vert_pos        ,   const glm::vec3&        vert_colour ,
+    GLuint*                 out             ,   cube_faces_t            face_flags  ,
+    int                     scale = 1
+);
+
 #endif // COMPACT_CUBE_MESH_SEPARABLE_H
@@ -57,6 +57,8 @@ VoxelApp::VoxelApp(Coil::Window& win, WorldManager& wm)
     world(wm),
     camera(win, 0, 65, 0),
     buffer_shader("Buffer"),
+    face_shader("Face"),
+    terrain_shader("Terrain"),
     deferred_shader("Deferred"),
     deferredRenderer(0, 0)
 {
@@ -106,13 +108,29 @@ void VoxelApp::setup_shaders() {
         });
     buffer_shader.Compile_And_Link();
 
+    face_shader.Add_Shaders({
+        Coil::shader_info_t{"face.vert",   Coil::shader_type_t::VERTEX_SHADER},
+        Coil::shader_info_t{"buffer.frag", Coil::shader_type_t::FRAGMENT_SHADER}
+        });
+    face_shader.Compile_And_Link();
+    face_shader.Use();
+    face_shader.Set_Int("chunk_offsets", CHUNK_OFFSET_TEXTURE_UNIT);
+
+    terrain_shader.Add_Shaders({
+        Coil::shader_info_t{"terrain.vert", Coil::shader_type_t::VERTEX_SHADER},
+        Coil::shader_info_t{"buffer.frag",  Coil::shader_type_t::FRAGMENT_SHADER}
+        });
+    terrain_shader.Compile_And_Link();
+
     deferred_shader.Add_Shaders({
         Coil::shader_info_t{"deferred.vert", Coil::shader_type_t::VERTEX_SHADER},
         Coil::shader_info_t{"deferred.frag", Coil::shader_type_t::FRAGMENT_SHADER}
         });
     deferred_shader.Compile_And_Link();
 
-    vertex_offset = buffer_shader.Get_Uniform("vertex_offset");
+    vertex_offset       = buffer_shader.Get_Uniform("vertex_offset");
+    face_vertex_offset  = face_shader  .Get_Uniform("vertex_offset");
+    terrain_vertex_offset = terrain_shader.Get_Uniform("vertex_offset");
 }
 
 /* ============================================================================
@@ -149,26 +167,42 @@ void VoxelApp::setup_gpu_query() {
  * Renders one frame of the application.
  * ============================================================================ */
 void VoxelApp::render_frame() {
-    glm::mat4 model = glm::mat4(1.0f);
+    glm::mat4 model      = glm::mat4(1.0f);
+    glm::mat4 projection = camera.Calc_Projection_Matrix();
+    glm::mat4 view       = camera.Calc_View_Matrix();
 
     // -- 1) Prepare G-buffer (not timed) --
     deferredRenderer.BindFramebuffer();
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    buffer_shader.Use();
-    buffer_shader.Set_Matrix4("projection", camera.Calc_Projection_Matrix());
-    buffer_shader.Set_Matrix4("view", camera.Calc_View_Matrix());
-    buffer_shader.Set_Matrix4("model", model);
+    // The G-buffer shader follows the chunk mesh format selected at runtime
+    const bool      packed_face   = world.Get_Settings().mesh_format == mesh_format_t::PACKED_FACE;
+    Coil::Shader&   active_shader = packed_face ? face_shader        : buffer_shader;
+    GLuint          active_offset = packed_face ? face_vertex_offset : vertex_offset;
+
+    active_shader.Use();
+    active_shader.Set_Matrix4("projection", projection);
+    active_shader.Set_Matrix4("view", view);
+    active_shader.Set_Matrix4("model", model);
 
     // -- 2) Start CPU timer right before update+render --
     auto cpuStart = std::chrono::high_resolution_clock::now();
 
     //    a) Update world state
-    world.Update(camera.Get_Position());
+    world.Set_View(camera.Get_FOV(), camera.Get_WindowHeight());
+    world.Set_View_Projection(projection * view);
+    world.Update(camera.Get_Position(), camera.Get_Front());
 
     //    b) Issue draw calls (GPU timing still captured separately)
     glBeginQuery(GL_TIME_ELAPSED, queryID);
-    world.Render(buffer_shader, vertex_offset, camera.Get_Position(), camera.Get_Front());
+    world.Render(active_shader, active_offset, camera.Get_Position(), camera.Get_Front());
+
+    //    c) Far sectors picked by Render, as heightfield grids
+    terrain_shader.Use();
+    terrain_shader.Set_Matrix4("projection", projection);
+    terrain_shader.Set_Matrix4("view", view);
+    terrain_shader.Set_Matrix4("model", model);
+    world.Render_Far_Terrain(terrain_shader, terrain_vertex_offset);
     glEndQuery(GL_TIME_ELAPSED);
 
     // -- 3) Stop CPU timer immediately after render calls --
@@ -23,8 +23,12 @@ private:
     Coil::Fly_Camera camera;
     DeferredRenderer deferredRenderer;
     Coil::Shader buffer_shader;
+    Coil::Shader face_shader;
+    Coil::Shader terrain_shader;
     Coil::Shader deferred_shader;
     GLuint vertex_offset;
+    GLuint face_vertex_offset;
+    GLuint terrain_vertex_offset;
     GLuint queryID;
 
     struct TimingStats {
@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <iomanip>
 #include <vector>
 #include <cstring>
 #include <stdexcept>
@@ -31,7 +32,7 @@
  *   colour    - colour vector (RGB).
  * ============================================================================
  */
-void generate_blocks(World& world, const glm::ivec3& start_pos, const glm::ivec3& end_pos, glm::ivec3 colour) {
+inline void generate_blocks(World& world, const glm::ivec3& start_pos, const glm::ivec3& end_pos, glm::ivec3 colour) {
     int count = 0;
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -70,7 +71,7 @@ void generate_blocks(World& world, const glm::ivec3& start_pos, const glm::ivec3
  *   end_pos   - 3D end position (exclusive).
  * ============================================================================
  */
-void generate_blocks_wave(World& world, const glm::ivec3& start_pos, const glm::ivec3& end_pos) {
+inline void generate_blocks_wave(World& world, const glm::ivec3& start_pos, const glm::ivec3& end_pos) {
     int count = 0;
     auto start = std::chrono::high_resolution_clock::now();
 
@@ -118,7 +119,7 @@ void generate_blocks_wave(World& world, const glm::ivec3& start_pos, const glm::
  *   world - the World instance to add voxels to.
  * ============================================================================
  */
-void generate_checkerboard(World& world) {
+inline void generate_checkerboard(World& world) {
     constexpr int SIZE_X = 16;
     constexpr int SIZE_Y = 64;
     constexpr int SIZE_Z = 16;
@@ -166,7 +167,7 @@ void generate_checkerboard(World& world) {
  *   world - the World instance to add voxels to.
  * ============================================================================
  */
-void generate_solid_block(World& world) {
+inline void generate_solid_block(World& world) {
     constexpr int SIZE_X = 16;
     constexpr int SIZE_Y = 64;
     constexpr int SIZE_Z = 16;
@@ -211,16 +212,17 @@ void generate_solid_block(World& world) {
  * Parameters:
  *   world        - the World instance to add voxels to.
  *   solid_chance - probability between 0.0 and 1.0 that a voxel is solid.
+ *   seed         - random seed; pass a fixed one for a repeatable block.
  * ============================================================================
  */
-void generate_random_block(World& world, float solid_chance) {
+inline void generate_random_block(World& world, float solid_chance, uint32_t seed = std::random_device{}()) {
     constexpr int SIZE_X = 16;
     constexpr int SIZE_Y = 64;
     constexpr int SIZE_Z = 16;
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    std::mt19937 rng(std::random_device{}());
+    std::mt19937 rng(seed);
     std::uniform_real_distribution<float> dist(0.0f, 1.0f);
 
     int solid_voxel_count = 0;
@@ -114,6 +114,7 @@ inline void Create_Static_Model_World(WorldManager& world) {
 
     // === Debug & Development ===
     s.smart_render           = true;    // Only render visible chunks
+    s.occlusion_cull         = true;    // Dense models hide most of themselves
     s.debug                  = false;   // Disable debug logs
 
     // === Default Chunk Prototype ===
@@ -249,6 +250,7 @@ inline void Create_Dynamic_World(WorldManager& world) {
     s.render_world           = true;    // Enable world rendering
     s.mesh_changes           = true;    // Enable mesh regeneration
     s.update_interval_ms     = 250;     // Mesh update interval (ms)
+    s.use_mesh_cache         = true;    // Reuse meshes saved with the chunks
 
     // === Level of Detail (LOD) ===
     s.use_lod                = false;   // Disable LOD
@@ -5,9 +5,8 @@
  * Constructor for Chunk class, initializing a new chunk
  * ============================================================================
  */
-Chunk::Chunk() : chunk_data({ lod_Level_t::UNSET, true}) {  // Default LOD to 1.0
+Chunk::Chunk() : dirty_sections(ALL_SECTIONS), chunk_data({ lod_Level_t::UNSET, true, mesh_format_t::PACKED_VERTEX }) {  // Default LOD to 1.0
     voxels.resize(MAX_VOX_LOC);
-    mesh = Coil::Basic_Mesh();
 }
 
 /* ============================================================================
@@ -17,8 +16,19 @@ Chunk::Chunk() : chunk_data({ lod_Level_t::UNSET, true}) {  // Default LOD to 1.
  */
 Chunk::Chunk(const Chunk& other) {
     voxels = other.voxels;
-    mesh = other.mesh;
+    for (int s = 0; s < NUM_SECTIONS; ++s) {
+        sections[s].front.mesh       = other.sections[s].front.mesh;
+        sections[s].front.num_faces  = other.sections[s].front.num_faces;
+        sections[s].front.face_slots = other.sections[s].front.face_slots;
+        sections[s].front.patchable  = other.sections[s].front.patchable;
+    }
+    // A build in progress is not copied, its sections are rebuilt instead
+    dirty_sections = other.dirty_sections | other.build_sections;
+    for (int s = 0; s < NUM_SECTIONS; ++s) {
+        if (other.sections[s].back_ready) dirty_sections |= 1 << s;
+    }
     chunk_data= other.chunk_data;
+    mip = other.mip;
 }
 
 /* ============================================================================
@@ -28,7 +38,10 @@ Chunk::Chunk(const Chunk& other) {
  */
 Chunk::~Chunk() {
     voxels.clear();
-    mesh.Clear_Mesh();
+    for (chunk_section_t& section : sections) {
+        section.front.mesh.Clear_Mesh();
+        section.back .mesh.Clear_Mesh();
+    }
 }
 
 /* ============================================================================
@@ -85,11 +98,10 @@ const Voxel* Chunk::Get_Voxel(glm::ivec3 pos) const {
  */
 void Chunk::Create_Voxel(vox_data_t data) {
     Voxel vox(data);
-    voxels[
-        voxel_loc_t::Compact(
-            Convert_Loc_2_Offset(data.position, data.rel, rel_loc_t::CHUNK_LOC)
-        ).location
-    ] = vox;
+    glm::ivec3 pos = Convert_Loc_2_Offset(data.position, data.rel, rel_loc_t::CHUNK_LOC);
+    Voxel& slot = voxels[voxel_loc_t::Compact(pos).location];
+    mip.Apply_Write(pos, slot, vox);
+    slot = vox;
 }
 
 /* ============================================================================
@@ -102,11 +114,11 @@ void Chunk::Create_Voxel(vox_data_t data) {
  * ============================================================================
  */
 void Chunk::Remove_Voxel(glm::ivec3 pos, rel_loc_t rel) {
-    voxels[
-        voxel_loc_t::Compact(
-            Convert_Loc_2_Offset(pos, rel, rel_loc_t::CHUNK_LOC)
-        ).location
-    ].SetType(voxel_type_t::AIR);
+    glm::ivec3 local = Convert_Loc_2_Offset(pos, rel, rel_loc_t::CHUNK_LOC);
+    Voxel& slot = voxels[voxel_loc_t::Compact(local).location];
+    Voxel  old  = slot;
+    slot.SetType(voxel_type_t::AIR);
+    mip.Apply_Write(local, old, slot);
 }
 
 /* ============================================================================
@@ -118,17 +130,18 @@ void Chunk::Remove_Voxel(glm::ivec3 pos, rel_loc_t rel) {
  * ============================================================================
  */
 voxels_t* Chunk::Get_All_Voxels() {
+    mip.Invalidate();   // Caller may write through the pointer
     return &voxels;
 }
 
 
 /* ============================================================================
  * --------------------------- Get_Mesh
- * Returns a reference to the mesh
+ * Returns a reference to the mesh drawn for a section
  * ============================================================================
  */
-Coil::Basic_Mesh& Chunk::Get_Mesh() {
-    return mesh;
+Coil::Basic_Mesh& Chunk::Get_Mesh(int section) {
+    return sections[section].front.mesh;
 }
 
 /* ============================================================================
@@ -136,8 +149,196 @@ Coil::Basic_Mesh& Chunk::Get_Mesh() {
  * Sets a new mesh for the chunk
  * ============================================================================
  */
-void Chunk::Set_Mesh(const Coil::Basic_Mesh& newMesh) {
-    mesh = newMesh;
+void Chunk::Set_Mesh(int section, const Coil::Basic_Mesh& newMesh) {
+    Get_Mesh(section) = newMesh;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Section_Faces
+ * Returns how many faces the mesh drawn for a section holds
+ * ============================================================================
+ */
+int Chunk::Get_Section_Faces(int section) const {
+    return sections[section].front.num_faces;
+}
+
+/* ============================================================================
+ * --------------------------- Face slots
+ * The slot map records where each voxel's faces sit in the drawn mesh of
+ * a section, so a recolour can overwrite them in place. Only full detail
+ * meshes are patchable; merged LOD faces do not map back to single voxels.
+ * ============================================================================
+ */
+const face_slots_t& Chunk::Get_Face_Slots(int section) const {
+    return sections[section].front.face_slots;
+}
+
+bool Chunk::Is_Section_Patchable(int section) const {
+    return sections[section].front.patchable;
+}
+
+/* ============================================================================
+ * --------------------------- Face ranges
+ * Where each face direction sits in the drawn mesh of a section, and for
+ * patchable sections where each face of the slot map was grouped to.
+ * ============================================================================
+ */
+const face_ranges_t& Chunk::Get_Face_Ranges(int section) const {
+    return sections[section].front.face_ranges;
+}
+
+const std::vector<uint16_t>& Chunk::Get_Face_Order(int section) const {
+    return sections[section].front.face_order;
+}
+
+/* ============================================================================
+ * --------------------------- Exchange_Meshes
+ * Swaps every section's drawn mesh, face count and maps with a parked copy,
+ * without touching the GL objects. Exchanging with empty sections takes the
+ * chunk's meshes out and leaves it with nothing to draw.
+ *
+ * ------ Parameters ------
+ * parked:      One parked section per chunk section, bottom up
+ * ============================================================================
+ */
+void Chunk::Exchange_Meshes(section_mesh_t (&parked)[NUM_SECTIONS]) {
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        Swap_Section_Mesh(sections[section].front, parked[section]);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Clear_Meshes
+ * Frees every section's drawn mesh and drops any build in progress. The
+ * sections that build still had to do are marked dirty again.
+ * ============================================================================
+ */
+void Chunk::Clear_Meshes() {
+    Restart_Build();
+    for (chunk_section_t& section : sections) {
+        Clear_Section_Mesh(section.front);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Section builds
+ * A build fills each section's back mesh while the front one is still
+ * drawn, and may be spread over several calls (frames). The first
+ * Take_Build_Sections starts it with the dirty sections (every section
+ * if none is flagged) and clears them, so edits made while it runs mark
+ * the sections dirty again for the next build instead of joining this
+ * one. Each call hands out at most `max_sections` of what is left, bottom
+ * up. Finish_Mesh records a built back mesh, and once none is left
+ * Swap_Meshes puts every built one in front at once, so the chunk never
+ * draws half of one build and half of the last.
+ * ============================================================================
+ */
+int Chunk::Take_Build_Sections(int max_sections) {
+    if (!Is_Building()) {
+        build_sections = dirty_sections ? dirty_sections : ALL_SECTIONS;
+        dirty_sections = 0;
+    }
+
+    int taken = 0;
+    for (int section = 0; section < NUM_SECTIONS && max_sections > 0; ++section) {
+        if (!(build_sections & (1 << section))) continue;
+        taken |= 1 << section;
+        --max_sections;
+    }
+    build_sections &= ~taken;
+    return taken;
+}
+
+int Chunk::Get_Build_Sections() const {
+    return build_sections;
+}
+
+section_mesh_t& Chunk::Get_Back_Section(int section) {
+    return sections[section].back;
+}
+
+/* ============================================================================
+ * --------------------------- Finish_Mesh
+ * Records that a section's back mesh has just been built. The back mesh
+ * and its maps are already filled; it is drawn from the next Swap_Meshes.
+ *
+ * ------ Parameters ------
+ * section:     The section that was built
+ * format:      The layout of the new mesh
+ * num_faces:   Faces in the new mesh (0 for an empty section)
+ * ============================================================================
+ */
+void Chunk::Finish_Mesh(int section, mesh_format_t format, int num_faces) {
+    chunk_section_t& s = sections[section];
+    s.back.num_faces = num_faces;
+    s.back_ready     = true;
+    build_format     = format;
+}
+
+bool Chunk::Is_Back_Ready(int section) const {
+    return sections[section].back_ready;
+}
+
+/* ============================================================================
+ * --------------------------- Is_Building
+ * Whether a build has sections left to do or built ones not yet swapped in
+ * ============================================================================
+ */
+bool Chunk::Is_Building() const {
+    if (build_sections != 0) return true;
+    for (const chunk_section_t& section : sections) {
+        if (section.back_ready) return true;
+    }
+    return false;
+}
+
+mesh_format_t Chunk::Get_Build_Format() const {
+    return build_format;
+}
+
+/* ============================================================================
+ * --------------------------- Swap_Meshes
+ * Puts every built back mesh in front and frees the mesh it replaces. The
+ * chunk's mesh format becomes the build's.
+ *
+ * ------ Returns ------
+ * Bit per section swapped in
+ * ============================================================================
+ */
+int Chunk::Swap_Meshes() {
+    int swapped = 0;
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        chunk_section_t& s = sections[section];
+        if (!s.back_ready) continue;
+
+        Swap_Section_Mesh(s.front, s.back);
+        Clear_Section_Mesh(s.back);
+        s.back_ready = false;
+        swapped |= 1 << section;
+    }
+    if (swapped) chunk_data.mesh_format = build_format;
+    return swapped;
+}
+
+/* ============================================================================
+ * --------------------------- Restart_Build
+ * Drops a build in progress, freeing its back meshes and marking the
+ * sections it covered dirty again so the next build redoes them. A
+ * generator finishes every section it takes before it returns, so no
+ * section is ever taken but not yet built here.
+ * ============================================================================
+ */
+void Chunk::Restart_Build() {
+    dirty_sections |= build_sections;
+    build_sections  = 0;
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        chunk_section_t& s = sections[section];
+        if (!s.back_ready) continue;
+
+        Clear_Section_Mesh(s.back);
+        s.back_ready    = false;
+        dirty_sections |= 1 << section;
+    }
 }
 
 
@@ -149,12 +350,126 @@ void Chunk::Set_Mesh(const Coil::Basic_Mesh& newMesh) {
  */
 
 void Chunk::Draw_Mesh(){
-    mesh.Draw_Mesh(false);
+    for (int s = 0; s < NUM_SECTIONS; ++s) {
+        Draw_Section(s);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Draw_Section
+ * Draws a single section, skipping it if it has no faces. When only some
+ * face directions are wanted, or they are wanted in a given order, ranges
+ * that follow each other in the buffer are drawn with one call (Face_Runs).
+ *
+ * ------ Parameters ------
+ * section:     The section to draw
+ * faces:       The face directions to draw
+ * order:       Optional order to draw the directions in (cube_faces_t
+ *              shifts); buffer order when null
+ * draw:        The chunk's index in this frame's Chunk_Offsets
+ *
+ * ------ Returns ------
+ * The number of faces submitted
+ * ============================================================================
+ */
+int Chunk::Draw_Section(int section, cube_faces_t faces, const int* order, GLuint draw) {
+    const section_mesh_t& s = sections[section].front;
+    if (s.num_faces == 0) return 0;
+
+    // Indexed quads draw 6 indices per face, face records one instance
+    const int units = chunk_data.mesh_format == mesh_format_t::PACKED_FACE ? 1 : FACE_INDEX_SIZE;
+
+    face_run_t runs[NUM_FACES];
+    const int  num_runs = Face_Runs(s.face_ranges, s.num_faces, faces, order, runs);
+
+    int drawn = 0;
+    for (int r = 0; r < num_runs; ++r) {
+        Get_Mesh(section).Draw_Mesh_Range(runs[r].first * units, runs[r].count * units, draw);
+        drawn += runs[r].count;
+    }
+    return drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Section dirty flags
+ * Bit s of the mask marks section s (voxels y = s*16 .. s*16+15) as needing
+ * a remesh. The mesher only rebuilds flagged sections.
+ * ============================================================================
+ */
+void Chunk::Mark_Sections_Dirty(int mask) {
+    dirty_sections |= mask & ALL_SECTIONS;
+}
+
+int Chunk::Get_Dirty_Sections() const {
+    return dirty_sections;
+}
+
+void Chunk::Clear_Dirty_Sections() {
+    dirty_sections = 0;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Section_Mask
+ * Returns the sections whose mesh depends on the voxel at chunk local
+ * height y: its own section, plus the one above or below when y sits on a
+ * section boundary
+ * ============================================================================
+ */
+int Chunk::Get_Section_Mask(int y) {
+    const int section = y / SECTION_SIZE_Y;
+    const int local_y = y % SECTION_SIZE_Y;
+
+    int mask = 1 << section;
+    if (local_y == 0                  && section > 0               ) mask |= 1 << (section - 1);
+    if (local_y == SECTION_SIZE_Y - 1 && section < NUM_SECTIONS - 1) mask |= 1 << (section + 1);
+    return mask;
 }
 
 void Chunk::Set_Cube(glm::ivec3 pos, vox_data_t data){
-    voxels[voxel_loc_t::Compact(pos).location] = Voxel(data);
+    Voxel& slot = voxels[voxel_loc_t::Compact(pos).location];
+    Voxel  vox(data);
+    mip.Apply_Write(pos, slot, vox);
+    slot = vox;
     chunk_data.updated = true;
+    Mark_Sections_Dirty(Get_Section_Mask(pos.y));
+}
+
+/* ============================================================================
+ * --------------------------- Recolour_Voxel
+ * Changes a voxel's colour without touching its solidity and keeps the LOD
+ * pyramid in step. Nothing is marked dirty: a colour change does not alter
+ * which faces exist, so the caller can patch the mesh instead.
+ *
+ * ------ Parameters ------
+ * pos:     Chunk local position of the voxel
+ * colour:  New colour (0-15 per channel)
+ * ============================================================================
+ */
+void Chunk::Recolour_Voxel(glm::ivec3 pos, glm::ivec3 colour) {
+    Voxel& slot = voxels[voxel_loc_t::Compact(pos).location];
+    Voxel  old  = slot;
+    slot.SetColour(colour);
+    mip.Apply_Write(pos, old, slot);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Mip
+ * Returns the chunk's LOD pyramid, building it first if it is stale.
+ * ============================================================================
+ */
+const Chunk_Mip& Chunk::Get_Mip() {
+    if (!mip.Is_Valid()) mip.Build(voxels);
+    return mip;
+}
+
+/* ============================================================================
+ * --------------------------- Invalidate_Mip
+ * Must be called after editing voxels through a raw Voxel pointer so the
+ * pyramid is rebuilt before the next LOD mesh.
+ * ============================================================================
+ */
+void Chunk::Invalidate_Mip() {
+    mip.Invalidate();
 }
 
 
@@ -193,4 +508,23 @@ void Chunk::deserialize(std::istream& in) {
     in.read(reinterpret_cast<char*>(&size), sizeof(size)); // read vector size
     voxels.resize(size);
     in.read(reinterpret_cast<char*>(voxels.data()), size * sizeof(Voxel)); // read voxel data
-}
\ No newline at end of file
+    mip.Invalidate();
+}
+
+/* ============================================================================
+ * --------------------------- Hash_Voxels
+ * 64-bit FNV-1a hash of the raw voxel data. Used to tell whether a cached
+ * mesh was built from the same voxels.
+ * ============================================================================
+ */
+uint64_t Chunk::Hash_Voxels() const {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(voxels.data());
+    const size_t         size  = voxels.size() * sizeof(Voxel);
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
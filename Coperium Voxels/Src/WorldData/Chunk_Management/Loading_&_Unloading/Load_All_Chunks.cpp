@@ -102,6 +102,7 @@ void WorldManager::Load_All_Chunks() {
             Chunk chunk;
             if (Read_Chunk(sector_loc, chunk_loc, chunk)) {
                 sector->Add_Chunk(chunk_loc, chunk);
+                world.Mark_Chunk_Dirty(sector_loc, chunk_loc);
                 std::cout << "Loaded chunk from file: "
                     << file_entry.path() << std::endl;
             }
@@ -20,6 +20,8 @@
  * - Determines if a chunk column exists in the sector.
  * - If the chunk column does not exist, attempts to load from a file.
  * - If loading fails, creates a chunk using createChunkFunc.
+ * - Columns behind the far terrain that the heightfield already holds are
+ *   left unloaded; the terrain grid is drawn in their place.
  * ============================================================================
  */
 void WorldManager::Load_New_Chunks(
@@ -28,6 +30,12 @@ void WorldManager::Load_New_Chunks(
 ) {
     glm::ivec3 sector_new, chunk_new;
 
+    const glm::vec3 camera = glm::vec3(
+        current_sector.x * SECTR_SIZE_X + current_chunk.x * CHUNK_SIZE_X,
+        0,
+        current_sector.z * SECTR_SIZE_Z + current_chunk.z * CHUNK_SIZE_Z
+    ) + glm::vec3(HALF_CHUNK.x, 0, HALF_CHUNK.z);
+
     for (int dx = -settings.chunk_radius; dx <= settings.chunk_radius; ++dx) {
         for (int dz = -settings.chunk_radius; dz <= settings.chunk_radius; ++dz) {
             if (dx == 0 && dz == 0) continue;
@@ -49,7 +57,12 @@ void WorldManager::Load_New_Chunks(
                 }
             }
 
-            if (!column_exists) {
+            const sector_loc_t sector_loc = sector_loc_t::Compact(glm::ivec3(sector_new.x, 0, sector_new.z));
+            const bool behind_terrain = terrain_tracked &&
+                Behind_Far_Terrain(sector_loc, camera) &&
+                far_terrain.Has_Column(sector_loc, chunk_loc_t::Compact(glm::ivec3(chunk_new.x, 0, chunk_new.z)));
+
+            if (!column_exists && !behind_terrain) {
                 Load_Chunk(sector_new, chunk_new);
             }
         }
@@ -74,6 +74,8 @@ void WorldManager::Store_Chunk(
  * ------ Returns ------
  * bool             : True if the chunk was successfully
  *                    loaded, false otherwise.
+ *
+ * A loaded chunk is flagged to look for a cached mesh at its first build.
  * ============================================================================
  */
 bool WorldManager::Read_Chunk(
@@ -105,5 +107,85 @@ bool WorldManager::Read_Chunk(
 
     chunk.deserialize(in);
     in.close();
+    chunk.Get_Chunk_Data().try_mesh_cache = true;
     return true;
 }
+
+/* ============================================================================
+ * --------------------------- Store_Mesh_Cache
+ * Saves a chunk's built mesh next to its chunk file, as <chunk>.mesh.
+ * Does nothing if chunk storing is off.
+ *
+ * ------ Parameters ------
+ * sector_location  : The encoded sector location.
+ * chunk_location   : The encoded chunk location.
+ * cache            : The captured mesh and the key it was built for.
+ * ============================================================================
+ */
+void WorldManager::Store_Mesh_Cache(
+    sector_loc_t        sector_location,
+    chunk_loc_t         chunk_location,
+    const mesh_cache_t& cache
+) {
+    if (!settings.allow_chunk_store) return;
+
+    fs::path sector_path =
+        fs::path(WORLD_SAVES_DIR) / world_name /
+        std::to_string(sector_location.location);
+
+    fs::create_directories(sector_path);
+
+    Save_Mesh_Cache_File(
+        sector_path / (std::to_string(chunk_location.location) + MESH_CACHE_EXT),
+        cache
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Read_Mesh_Cache
+ * Loads a chunk's cached mesh, if one was saved. Ignored while chunk
+ * storing is off, as nothing then keeps the files in step with the chunks.
+ *
+ * ------ Returns ------
+ * bool             : True if a complete cache file was read. The caller
+ *                    still has to check that its key matches.
+ * ============================================================================
+ */
+bool WorldManager::Read_Mesh_Cache(
+    sector_loc_t    sector_location,
+    chunk_loc_t     chunk_location,
+    mesh_cache_t&   cache
+) {
+    if (!settings.allow_chunk_store) return false;
+
+    fs::path cache_file =
+        fs::path(WORLD_SAVES_DIR) / world_name /
+        std::to_string(sector_location.location) /
+        (std::to_string(chunk_location.location) + MESH_CACHE_EXT);
+
+    if (!fs::exists(cache_file)) return false;
+    return Load_Mesh_Cache_File(cache_file, cache);
+}
+
+/* ============================================================================
+ * --------------------------- Store_Far_Terrain
+ * Saves the far terrain heightfields that changed since they were last
+ * saved, one file per sector folder. Does nothing if chunk storing is off.
+ * ============================================================================
+ */
+void WorldManager::Store_Far_Terrain() {
+    if (!settings.allow_chunk_store || !terrain_tracked) return;
+    far_terrain.Save(fs::path(WORLD_SAVES_DIR) / world_name);
+}
+
+/* ============================================================================
+ * --------------------------- Read_Far_Terrain
+ * Loads every far terrain heightfield saved with the world.
+ * ============================================================================
+ */
+void WorldManager::Read_Far_Terrain() {
+    const int loaded = far_terrain.Load(fs::path(WORLD_SAVES_DIR) / world_name);
+    if (settings.debug && loaded > 0) {
+        std::cout << "Loaded " << loaded << " far terrain sectors" << std::endl;
+    }
+}
@@ -4,7 +4,9 @@
 
 /* ============================================================================
  * --------------------------- Unload_Chunk
- * Saves and removes a chunk from the world, then updates neighbouring chunks.
+ * Saves and removes a chunk from the world, freeing its sections in the mesh
+ * arena (built and half built), any meshes parked for it in the LOD cache
+ * and its render queue entry, then updates neighbouring chunks.
  *
  * ------ Parameters ------
  * world         : Reference to the world containing sectors and chunks.
@@ -32,6 +34,14 @@ void WorldManager::Unload_Chunk(
         chunk_pair.first.Y(),
         chunk_pair.first.Z()
     );
+    if (hlods_tracked) hlod_groups.Mark_Dirty(sector_pair.first, chunk_pair.first);
+    const uint64_t arena_chunk = Mesh_Arena::Chunk_Key(sector_pair.first, chunk_pair.first);
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        mesh_arena.Free_Section(Mesh_Arena::Section_Key(arena_chunk, section));
+        mesh_arena.Free_Section(Mesh_Arena::Back_Key(Mesh_Arena::Section_Key(arena_chunk, section)));
+    }
+    lod_mesh_cache.Drop(sector_pair.first, chunk_pair.first);
+    render_queue.Remove(sector_pair.first, chunk_pair.first);
     sector->Remove_Chunk(chunk_loc, rel_loc_t::CHUNK_LOC);
 
     // Update neighbouring chunks
@@ -67,7 +77,7 @@ void WorldManager::Unload_Chunk(
  * by adding HALF_CHUNK. The squared distance from the camera to the chunk
  * center is computed and compared to a threshold derived from the unload
  * radius. If the distance is greater, the chunk is first stored to disk,
- * then unloaded.
+ * then unloaded. Changed far terrain heightfields are saved afterwards.
  * ============================================================================
  */
 void WorldManager::Unload_Far_Chunks(const glm::ivec3& curr_position) {
@@ -102,4 +112,139 @@ void WorldManager::Unload_Far_Chunks(const glm::ivec3& curr_position) {
             Unload_Chunk(sector_pair, chunk_pair);
         }
     }
+
+    // Heightfields outlive their chunks; keep the saved copy current
+    Store_Far_Terrain();
+}
+
+
+/* ============================================================================
+ * --------------------------- Release_Far_Chunk
+ * Frees a chunk of a sector behind the far terrain, as only the terrain
+ * grid is drawn there. With chunk storing on it is saved and unloaded, and
+ * Load_New_Chunks leaves it on disk. Otherwise its voxels could not be read
+ * back, so only its meshes, and any build in progress, are dropped; it is
+ * marked dirty and waits in far_deferred until the camera comes near again.
+ *
+ * ------ Returns ------
+ * false if the chunk had nothing left to free
+ * ============================================================================
+ */
+bool WorldManager::Release_Far_Chunk(
+    const sector_pair_t& sector_pair,
+    const chunk_pair_t&  chunk_pair
+) {
+    if (settings.allow_chunk_store) {
+        Unload_Chunk(sector_pair, chunk_pair);
+        return true;
+    }
+
+    Chunk& chunk = *chunk_pair.second;
+    int faces = 0;
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        faces += chunk.Get_Section_Faces(section);
+    }
+    if (faces == 0 && !chunk.Is_Building()) return false;  // Never meshed or already released
+
+    const uint64_t arena_chunk = Mesh_Arena::Chunk_Key(sector_pair.first, chunk_pair.first);
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        mesh_arena.Free_Section(Mesh_Arena::Section_Key(arena_chunk, section));
+        mesh_arena.Free_Section(Mesh_Arena::Back_Key(Mesh_Arena::Section_Key(arena_chunk, section)));
+    }
+    chunk.Clear_Meshes();
+    chunk.Get_Chunk_Data().mesh_key = 0;
+    lod_mesh_cache.Drop(sector_pair.first, chunk_pair.first);
+    world.Mark_Chunk_Dirty(sector_pair.first, chunk_pair.first);
+    return true;
+}
+
+
+/* ============================================================================
+ * --------------------------- Release_Far_Sectors
+ * Frees the held chunks of the sectors that went behind the far terrain
+ * since the last call; sectors that were already behind were handled then,
+ * and later columns arrive through Release_Far_Columns. Only sectors are
+ * tested, and only the chunks of those that crossed are visited. The first
+ * pass, and one after far_terrain_distance changed, counts every sector
+ * behind the terrain as crossing.
+ *
+ * ------ Parameters ------
+ * player_position: The current camera position.
+ * ============================================================================
+ */
+void WorldManager::Release_Far_Sectors(const glm::vec3& player_position) {
+    if (!settings.use_far_terrain || !terrain_tracked) {
+        released_distance = -1.0f;
+        return;
+    }
+
+    const bool  first  = released_distance != settings.far_terrain_distance;
+    const float before = released_distance + FAR_TERRAIN_MARGIN;
+    int released = 0;
+    std::vector<chunk_pair_t> chunks_to_release;
+
+    for (auto sector_pair : *world.Get_All_Sectrs()) {
+        if (!Behind_Far_Terrain(sector_pair.first, player_position)) continue;
+        if (!first && Far_Terrain::Sector_Distance(sector_pair.first, released_at) > before) continue;
+
+        chunks_to_release.clear();
+        for (auto chunk_pair : *sector_pair.second->Get_All_Chunks()) {
+            if (far_terrain.Has_Column(sector_pair.first, chunk_pair.first)) {
+                chunks_to_release.emplace_back(chunk_pair);
+            }
+        }
+        for (const auto& chunk_pair : chunks_to_release) {
+            if (Release_Far_Chunk(sector_pair, chunk_pair)) ++released;
+        }
+    }
+
+    released_at       = player_position;
+    released_distance = settings.far_terrain_distance;
+
+    if (released == 0) return;
+    Store_Far_Terrain();
+
+    if (settings.debug) {
+        std::cout << "Released " << released << " chunks in sectors behind the far terrain\n";
+    }
+}
+
+
+/* ============================================================================
+ * --------------------------- Release_Far_Columns
+ * Frees the chunks of the columns the last far terrain update started
+ * holding, in sectors behind the terrain. The cost follows the number of
+ * columns scanned, not the number of chunks loaded.
+ *
+ * ------ Parameters ------
+ * player_position: The current camera position.
+ * ============================================================================
+ */
+void WorldManager::Release_Far_Columns(const glm::vec3& player_position) {
+    if (!settings.use_far_terrain || !terrain_tracked) return;
+
+    int released = 0;
+    for (const far_column_t& held : far_terrain.Get_Held_Columns()) {
+        if (!Behind_Far_Terrain(held.sector, player_position)) continue;
+
+        std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(held.sector);
+        if (!sector_ptr || !*sector_ptr) continue;
+
+        sector_loc_t        sector_loc  = held.sector;
+        const sector_pair_t sector_pair = { sector_loc, *sector_ptr };
+
+        for (int y = MIN_ID_C_Y; y <= MAX_ID_C_Y; ++y) {
+            const chunk_loc_t chunk_loc = chunk_loc_t::Compact(glm::ivec3(held.column.X(), y, held.column.Z()));
+            std::shared_ptr<Chunk>* chunk_ptr = (*sector_ptr)->Get_All_Chunks()->Find(chunk_loc);
+            if (!chunk_ptr || !*chunk_ptr) continue;
+            if (Release_Far_Chunk(sector_pair, { chunk_loc, *chunk_ptr })) ++released;
+        }
+    }
+
+    if (released == 0) return;
+    Store_Far_Terrain();
+
+    if (settings.debug) {
+        std::cout << "Released " << released << " chunks of columns behind the far terrain\n";
+    }
 }
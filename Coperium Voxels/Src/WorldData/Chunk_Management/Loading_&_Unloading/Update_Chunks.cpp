@@ -34,6 +34,7 @@ void WorldManager::Dynamic_Update_Chunks(glm::vec3 player_position) {
         if (load_callback) load_callback(*this);
         Unload_Far_Chunks(curr_position);
     }
+    Release_Far_Sectors(player_position);
 
     if (settings.auto_load) {
         if (unload_callback) unload_callback(*this);
@@ -2,9 +2,15 @@
 #ifndef CALCULATE_LOD_H
 #define CALCULATE_LOD_H
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <GLM/gtx/norm.hpp>
 #include "../../World.h"
 
+inline constexpr float LOD_DEFAULT_MARGIN      = 8.0f;    // Half a chunk either side of a threshold
+inline constexpr float LOD_DEFAULT_PIXEL_ERROR = 32.0f;   // Projected LOD cell size allowed on screen
+
 typedef struct lod_dst_set_t {
     enum class lod_Level_t : int {
         NORMAL = 0,
@@ -13,13 +19,15 @@ typedef struct lod_dst_set_t {
         COUNT // helper to determine array size
     };
     float thresholds[static_cast<int>(lod_Level_t::COUNT)];
-    
+    float margins   [static_cast<int>(lod_Level_t::COUNT)];   // Hysteresis past each threshold (world units)
+
     lod_dst_set_t() {
         thresholds[static_cast<int>(lod_Level_t::NORMAL )]  = 50.0f     * 50.0f;
         thresholds[static_cast<int>(lod_Level_t::LOD_2  )]  = 100.0f    * 100.0f;
         thresholds[static_cast<int>(lod_Level_t::LOD_4  )]  = 3000.0f   * 3000.0f;
         thresholds[static_cast<int>(lod_Level_t::LOD_8  )]  = 8000.0f   * 8000.0f;
         thresholds[static_cast<int>(lod_Level_t::LOD_16 )]  = std::numeric_limits<float>::max();
+        Set_All_Margins(LOD_DEFAULT_MARGIN);
     }
 
     lod_dst_set_t(
@@ -34,6 +42,7 @@ typedef struct lod_dst_set_t {
         thresholds[static_cast<int>(lod_Level_t::LOD_4)]    = lod4_sq;
         thresholds[static_cast<int>(lod_Level_t::LOD_8)]    = lod8_sq;
         thresholds[static_cast<int>(lod_Level_t::LOD_16)]   = lod16_sq;
+        Set_All_Margins(LOD_DEFAULT_MARGIN);
     }
 
     float Get_LOD_Threshold(lod_Level_t level) const {
@@ -43,6 +52,40 @@ typedef struct lod_dst_set_t {
     void Set_LOD_Threshold(lod_Level_t level, float distance_squared) {
         thresholds[static_cast<int>(level)] = distance_squared;
     }
+
+    float Get_LOD_Margin(lod_Level_t level) const {
+        return margins[static_cast<int>(level)];
+    }
+
+    void Set_LOD_Margin(lod_Level_t level, float distance) {
+        margins[static_cast<int>(level)] = distance;
+    }
+
+    void Set_All_Margins(float distance) {
+        for (float& margin : margins) margin = distance;
+    }
+
+    // Chunk LODs (1, 2, 4, ...) to and from the index of their threshold
+    static int Level_Index(::lod_Level_t l_o_d) {
+        switch (l_o_d) {
+        case ::lod_Level_t::NORMAL: return static_cast<int>(lod_Level_t::NORMAL);
+        case ::lod_Level_t::LOD_2 : return static_cast<int>(lod_Level_t::LOD_2 );
+        case ::lod_Level_t::LOD_4 : return static_cast<int>(lod_Level_t::LOD_4 );
+        case ::lod_Level_t::LOD_8 : return static_cast<int>(lod_Level_t::LOD_8 );
+        case ::lod_Level_t::LOD_16: return static_cast<int>(lod_Level_t::LOD_16);
+        default                   : return -1;
+        }
+    }
+
+    bool operator==(const lod_dst_set_t& other) const = default;
+
+    static ::lod_Level_t Index_Level(int index) {
+        static const ::lod_Level_t levels[static_cast<int>(lod_Level_t::COUNT)] = {
+            ::lod_Level_t::NORMAL, ::lod_Level_t::LOD_2, ::lod_Level_t::LOD_4,
+            ::lod_Level_t::LOD_8 , ::lod_Level_t::LOD_16
+        };
+        return levels[index];
+    }
 }lod_dst_set_t;
 
 /*inline constexpr float THRESH_SQ0 = 50.0f * 50.0f;
@@ -58,14 +101,91 @@ inline constexpr float THRESH_SQ2 = 3000.0f * 3000.0f;
 inline constexpr float THRESH_SQ3 = 8000.0f * 8000.0f;
 
 
+/* ============================================================================
+ * --------------------------- LOD_Band_Edge
+ * Distance at which a chunk leaves the band of the level at `index`:
+ * the lower edge is the previous threshold pulled in by its margin, the
+ * upper edge this level's threshold pushed out by its margin. Open ends
+ * return -1 and FLT_MAX.
+ * ============================================================================
+ */
+inline float LOD_Band_Edge(const lod_dst_set_t& lod_settings, int index, bool upper) {
+    constexpr int last = static_cast<int>(lod_dst_set_t::lod_Level_t::COUNT) - 1;
+    const     int edge = upper ? index : index - 1;
+
+    if (edge < 0)                                       return -1.0f;
+    if (edge >= last ||
+        lod_settings.thresholds[edge] >= std::numeric_limits<float>::max()) {
+        return std::numeric_limits<float>::max();
+    }
+
+    const float threshold = std::sqrt(lod_settings.thresholds[edge]);
+    return upper ? threshold + lod_settings.margins[edge]
+                 : threshold - lod_settings.margins[edge];
+}
+
+/* ============================================================================
+ * --------------------------- Screen_Error_LOD_Set
+ * Distance thresholds that pick the coarsest level whose cells project to
+ * no more than `pixel_error` pixels. A cell of L voxels at distance d spans
+ *
+ *   L * viewport_height / (2 * d * tan(fov_y / 2))
+ *
+ * pixels, so level L is allowed from d = L * viewport_height /
+ * (2 * tan(fov_y / 2) * pixel_error) on and each level's threshold is where
+ * the next one becomes allowed. The result works with Compute_LOD and the
+ * LOD rings like any other set; margins are kept from `base`.
+ *
+ * ------ Parameters ------
+ * base            : Set used for its margins, and returned unchanged when
+ *                   the view is unknown (zero sized window or FOV)
+ * fov_y_degrees   : Vertical field of view of the projection
+ * viewport_height : Height of the viewport in pixels
+ * pixel_error     : Largest projected cell size allowed, in pixels
+ *
+ * ------ Returns ------
+ * The thresholds for this view
+ * ============================================================================
+ */
+inline lod_dst_set_t Screen_Error_LOD_Set(
+    const lod_dst_set_t &   base            ,
+    float                   fov_y_degrees   ,
+    int                     viewport_height ,
+    float                   pixel_error
+) {
+    if (viewport_height <= 0 || fov_y_degrees <= 0.0f || pixel_error <= 0.0f) return base;
+
+    constexpr int count = static_cast<int>(lod_dst_set_t::lod_Level_t::COUNT);
+    const float pixels_per_unit_at_1 =
+        static_cast<float>(viewport_height) / (2.0f * std::tan(glm::radians(fov_y_degrees) * 0.5f));
+
+    lod_dst_set_t set = base;
+    for (int i = 0; i < count - 1; ++i) {
+        const float cell = static_cast<float>(lod_dst_set_t::Index_Level(i + 1));
+        const float dst  = cell * pixels_per_unit_at_1 / pixel_error;
+        set.thresholds[i] = dst * dst;
+    }
+    set.thresholds[count - 1] = std::numeric_limits<float>::max();
+    return set;
+}
+
 /* ============================================================================
  * --------------------------- Compute_LOD
- * Computes the appropriate level of detail (LOD) for a chunk based on the squared
+ * Computes the appropriate level of detail (LOD) for a chunk based on the
  * distance from the camera to the chunk's center.
  *
+ * A chunk that already has a LOD keeps it until it is more than that
+ * threshold's margin past either edge of its band, so a camera hovering on
+ * a threshold does not flip the chunk back and forth.
+ *
  * ------ Parameters ------
- * camera_pos:  The position of the camera.
- * chunk_center: The center position of the chunk.
+ * sector_id:    Sector holding the chunk.
+ * chunk_id:     The chunk within the sector.
+ * camera_pos:   The position of the camera.
+ * lod_settings: Thresholds and margins per level.
+ * current:      The chunk's current LOD (UNSET for none).
+ * slack:        Optional, set to how far the camera can move before the
+ *               result could change.
  *
  * ------ Returns ------
  * The appropriate lod_Level_t based on the thresholds.
@@ -75,23 +195,40 @@ inline lod_Level_t Compute_LOD(
     const sector_loc_t          &   sector_id   ,
     const chunk_loc_t           &   chunk_id    ,
     const glm::vec3             &   camera_pos  ,
-    const lod_dst_set_t &   lod_settings
+    const lod_dst_set_t         &   lod_settings,
+    lod_Level_t                     current     = lod_Level_t::UNSET,
+    float                       *   slack       = nullptr
 ) {
+    constexpr int count = static_cast<int>(lod_dst_set_t::lod_Level_t::COUNT);
+
     glm::vec3 chunk_origin{
         sector_id.X() * SECTR_SIZE_X + chunk_id.X() * CHUNK_SIZE_X,
                                        chunk_id.Y() * CHUNK_SIZE_Y,
         sector_id.Z() * SECTR_SIZE_Z + chunk_id.Z() * CHUNK_SIZE_Z
     };
 
-    const float  dst        = glm::distance2(camera_pos, chunk_origin + HALF_CHUNK);
-    const float* thresholds = lod_settings.thresholds;
-
-    if (dst < thresholds[static_cast<int>(lod_Level_t::NORMAL)]) return lod_Level_t::NORMAL ;
-    if (dst < thresholds[static_cast<int>(lod_Level_t::LOD_2 )]) return lod_Level_t::LOD_2  ;
-    if (dst < thresholds[static_cast<int>(lod_Level_t::LOD_4 )]) return lod_Level_t::LOD_4  ;
-    if (dst < thresholds[static_cast<int>(lod_Level_t::LOD_8 )]) return lod_Level_t::LOD_8  ;
+    const float dst_sq = glm::distance2(camera_pos, chunk_origin + HALF_CHUNK);
+    const float dst    = std::sqrt(dst_sq);
+
+    int index = lod_dst_set_t::Level_Index(current);
+    if (index < 0 ||
+        dst <  LOD_Band_Edge(lod_settings, index, false) ||
+        dst >= LOD_Band_Edge(lod_settings, index, true )) {
+        index = count - 1;  // fallback
+        for (int i = 0; i < count - 1; ++i) {
+            if (dst_sq < lod_settings.thresholds[i]) { index = i; break; }
+        }
+    }
 
-    return lod_Level_t::LOD_16; // fallback
+    if (slack) {
+        const float lower = LOD_Band_Edge(lod_settings, index, false);
+        const float upper = LOD_Band_Edge(lod_settings, index, true );
+        *slack = std::max(0.0f, std::min(
+            lower < 0.0f                               ? std::numeric_limits<float>::max() : dst - lower,
+            upper == std::numeric_limits<float>::max() ? std::numeric_limits<float>::max() : upper - dst
+        ));
+    }
+    return lod_dst_set_t::Index_Level(index);
 }
 
 
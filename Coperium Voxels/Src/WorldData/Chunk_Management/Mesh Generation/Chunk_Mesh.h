@@ -4,6 +4,8 @@
 
 #include "../../World.h"
 #include "../../../Compact Data/Cube Mesh/CCMS.h"
+#include <COIL/Mesh/Quad_Index_Buffer.h>
+#include "Mesh_Scratch.h"
 #include <bitset>
 
 typedef enum n_chunk_t {
@@ -83,8 +85,63 @@ static inline int Count_Set_Bits(cube_faces_t flags) {
 const neighbouring_chunks_t get_chunk_neighbours(
     World& w, chunk_pair_t chunk, sector_pair_t sector, const Chunk& generic_chunk);
 
-int Generate_Chunk_Mesh(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk);
-int Generate_Chunk_Mesh(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk, int l_o_d);
+struct mesh_cache_t;
+class  Mesh_Arena;
+
+typedef struct mesh_gen_ctx_t {
+    Coil::Quad_Index_Buffer*    quad_indices    = nullptr;  // Shared quad indices (PACKED_VERTEX)
+    GLuint                      chunk_offsets   = 0;        // Chunk_Offsets buffer (PACKED_VERTEX)
+    mesh_format_t               format          = mesh_format_t::PACKED_VERTEX;
+    bool                        two_pass        = true;     // Count faces, then write into an exact size buffer
+    bool                        depth_sort      = true;     // Order each face direction near to far
+    bool                        upload          = true;     // false runs only the CPU half (benchmarks)
+    mesh_cache_t*               capture         = nullptr;  // Receives a copy of every uploaded section
+    Mesh_Arena*                 arena           = nullptr;  // Takes sections instead of their own meshes
+    uint64_t                    arena_chunk     = 0;        // Mesh_Arena::Chunk_Key of the chunk being built
+    int                         max_sections    = NUM_SECTIONS; // Sections one call may build (see Take_Build_Sections)
+} mesh_gen_ctx_t;
+
+int Generate_Chunk_Mesh(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk, const mesh_gen_ctx_t& ctx);
+int Generate_Chunk_Mesh(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk, int l_o_d, const mesh_gen_ctx_t& ctx);
+bool Finish_Chunk_Build(Chunk& chunk, const mesh_gen_ctx_t& ctx);
+void Restart_Chunk_Build(Chunk& chunk, const mesh_gen_ctx_t& ctx);
+
+int Generate_Chunk_Mesh_At_LOD(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk, const mesh_gen_ctx_t& ctx);
+
+int Count_Section_Faces(
+    const neighbouring_chunks_t&    c_neighbours,
+    Chunk&                          chunk,
+    int                             section,
+    uint8_t*                        masks,
+    int*                            visible_voxels
+);
+int Count_Chunk_Faces(World& w, sector_pair_t sector, chunk_pair_t chunk, const Chunk& generic_chunk, int sections);
+
+/* ============================================================================
+ * --------------------------- Mesh_Bytes_Per_Face
+ * GPU bytes one face takes in a mesh format.
+ * ============================================================================ */
+static inline size_t Mesh_Bytes_Per_Face(mesh_format_t format) {
+    return format == mesh_format_t::PACKED_FACE
+        ? CFD::WORDS_PER_FACE * sizeof(GLuint)
+        : FACE_VERT_SIZE      * sizeof(GLfloat);
+}
+
+void Upload_Mesh_Data(
+    Coil::Basic_Mesh&           mesh,
+    const std::vector<GLfloat>& vertex_mesh,
+    const std::vector<GLuint>&  face_mesh,
+    int                         num_faces,
+    const mesh_gen_ctx_t&       ctx
+);
+
+void Upload_Chunk_Mesh(
+    Chunk&                      chunk,
+    int                         section,
+    mesh_scratch_t&             scratch,
+    int                         num_faces,
+    const mesh_gen_ctx_t&       ctx
+);
 
 
 
@@ -0,0 +1,76 @@
+#include <GLAD/glad.h>
+#include "Chunk_Offsets.h"
+
+Chunk_Offsets::~Chunk_Offsets() {
+    if (texture) glDeleteTextures(1, &texture);
+    if (buffer)  glDeleteBuffers (1, &buffer);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Buffer
+ * Returns the buffer's name, making it and its buffer texture on the first
+ * call.
+ * ============================================================================ */
+GLuint Chunk_Offsets::Get_Buffer() {
+    if (buffer) return buffer;
+
+    const glm::vec4 none(0.0f);
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+    glBufferData(GL_TEXTURE_BUFFER, CHUNK_OFFSET_STRIDE, &none, GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    return buffer;
+}
+
+/* ============================================================================
+ * --------------------------- Begin_Frame
+ * Empties the list for a new frame, leaving only the zero offset at index 0
+ * that draws not made for a chunk read.
+ * ============================================================================ */
+void Chunk_Offsets::Begin_Frame() {
+    offsets.clear();
+    offsets.emplace_back(0.0f);
+}
+
+/* ============================================================================
+ * --------------------------- Add
+ * Adds a chunk's origin to this frame's list.
+ *
+ * ------ Returns ------
+ * The index draws of that chunk use to pick it
+ * ============================================================================ */
+GLuint Chunk_Offsets::Add(const glm::vec3& offset) {
+    offsets.emplace_back(offset, 0.0f);
+    return static_cast<GLuint>(offsets.size() - 1);
+}
+
+/* ============================================================================
+ * --------------------------- Upload
+ * Sends this frame's list to the GPU, orphaning last frame's storage so
+ * draws still reading it are not waited on. The texture follows the new
+ * storage since it refers to the buffer by name.
+ * ============================================================================ */
+void Chunk_Offsets::Upload() {
+    glBindBuffer(GL_TEXTURE_BUFFER, Get_Buffer());
+    glBufferData(GL_TEXTURE_BUFFER, offsets.size() * CHUNK_OFFSET_STRIDE, offsets.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+/* ============================================================================
+ * --------------------------- Bind_Texture
+ * Binds the buffer texture to CHUNK_OFFSET_TEXTURE_UNIT for face.vert.
+ * ============================================================================ */
+void Chunk_Offsets::Bind_Texture() const {
+    glActiveTexture(GL_TEXTURE0 + CHUNK_OFFSET_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+int Chunk_Offsets::Size() const {
+    return static_cast<int>(offsets.size());
+}
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef CHUNK_OFFSETS_H
+#define CHUNK_OFFSETS_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <vector>
+#include <GLFW/glfw3.h>
+#include <GLM/glm.hpp>
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr GLuint CHUNK_OFFSET_ATTRIB        = 3;    // aChunkOffset in buffer.vert
+constexpr GLuint CHUNK_OFFSET_TEXTURE_UNIT  = 7;    // chunk_offsets in face.vert
+constexpr GLsizei CHUNK_OFFSET_STRIDE       = sizeof(glm::vec4);
+
+//----------------------------------------------------------------------------//
+//                            CLASS: Chunk_Offsets                            //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * The world origin of every chunk drawn this frame, in one buffer filled
+ * once per frame from the visible list, so draws pick their chunk's offset
+ * by index instead of a vertex_offset uniform being set before each one.
+ *
+ * PACKED_VERTEX meshes read it as a per-instance vec3
+ * attribute at CHUNK_OFFSET_ATTRIB, and the draw's base instance is the
+ * index. PACKED_FACE meshes already use the base instance for their face
+ * records, so face.vert reads it through a buffer texture instead, at
+ * gl_VertexID / 6 with the index passed as the draw's first vertex. The
+ * mesh arena's commands do the same in either format.
+ *
+ * Index 0 always holds a zero offset, so every other draw (HLOD, terrain,
+ * anything drawn with base instance and first vertex 0) picks up nothing
+ * and keeps using its own vertex_offset uniform.
+ *
+ * Offsets are stored as vec4 (RGBA32F) so the texture needs nothing past
+ * GL 3.1. The buffer's name never changes, so VAOs pointed at it stay
+ * valid as it grows.
+ * ============================================================================ */
+class Chunk_Offsets {
+public:
+    ~Chunk_Offsets();
+
+    GLuint  Get_Buffer  ();
+    void    Begin_Frame ();
+    GLuint  Add         (const glm::vec3& offset);
+    void    Upload      ();
+    void    Bind_Texture() const;
+    int     Size        () const;
+
+private:
+    std::vector<glm::vec4>  offsets;
+    GLuint                  buffer  = 0;
+    GLuint                  texture = 0;
+};
+
+#endif // !CHUNK_OFFSETS_H
@@ -0,0 +1,110 @@
+#include "Face_Patch.h"
+
+#include <algorithm>
+#include <bitset>
+
+/* ============================================================================
+ * --------------------------- Get_Size / Get_Data
+ * Byte size and pointer of whichever array the patch was built into.
+ * ============================================================================ */
+GLsizeiptr face_patch_t::Get_Size() const {
+    return static_cast<GLsizeiptr>(
+        vertex_data.size() * sizeof(GLfloat) + face_data.size() * sizeof(GLuint)
+    );
+}
+
+const void* face_patch_t::Get_Data() const {
+    return vertex_data.empty()
+        ? static_cast<const void*>(face_data  .data())
+        : static_cast<const void*>(vertex_data.data());
+}
+
+/* ============================================================================
+ * --------------------------- Record_Face_Slot
+ * Appends a voxel's slot while a section is being meshed. Must be called in
+ * mesher order (x, then y, then z) so the slots stay sorted.
+ *
+ * ------ Parameters ------
+ * slots      : The section's slot map
+ * pos        : Chunk local voxel position
+ * first_face : Faces already in the section before this voxel's
+ * faces      : Faces the voxel emitted
+ * ============================================================================ */
+void Record_Face_Slot(
+    face_slots_t&       slots,
+    const glm::ivec3&   pos,
+    int                 first_face,
+    cube_faces_t        faces
+) {
+    if (!faces) return;
+    slots.push_back({
+        voxel_loc_t::Compact(pos).location,
+        static_cast<uint16_t>(first_face),
+        faces
+    });
+}
+
+/* ============================================================================
+ * --------------------------- Find_Face_Slot
+ * Looks up the slot of a voxel.
+ *
+ * ------ Returns ------
+ * The slot, or nullptr if the voxel emitted no faces in this section
+ * ============================================================================ */
+const face_slot_t* Find_Face_Slot(
+    const face_slots_t& slots,
+    const glm::ivec3&   pos
+) {
+    const uint16_t voxel = voxel_loc_t::Compact(pos).location;
+
+    auto it = std::lower_bound(
+        slots.begin(), slots.end(), voxel,
+        [](const face_slot_t& slot, uint16_t v) { return slot.voxel < v; }
+    );
+    return (it != slots.end() && it->voxel == voxel) ? &*it : nullptr;
+}
+
+/* ============================================================================
+ * --------------------------- Build_Recolour_Patch
+ * Regenerates a voxel's faces with a new colour and works out where they sit
+ * in the section's buffer. Faces, positions and order are unchanged, so the
+ * result can overwrite the old bytes in place.
+ *
+ * ------ Parameters ------
+ * slots  : The section's slot map
+ * pos    : Chunk local voxel position
+ * colour : New colour (0-15 per channel)
+ * format : Layout of the section's uploaded mesh
+ * patch  : Receives the offset and replacement data
+ *
+ * ------ Returns ------
+ * false if the voxel has no faces in the mesh, so there is nothing to patch
+ * ============================================================================ */
+bool Build_Recolour_Patch(
+    const face_slots_t& slots,
+    const glm::ivec3&   pos,
+    const glm::vec3&    colour,
+    mesh_format_t       format,
+    face_patch_t&       patch
+) {
+    const face_slot_t* slot = Find_Face_Slot(slots, pos);
+    if (!slot) return false;
+
+    patch.vertex_data.clear();
+    patch.face_data  .clear();
+    patch.first_face = slot->first_face;
+    patch.num_faces  = static_cast<int>(std::bitset<8>(slot->faces).count());
+
+    if (format == mesh_format_t::PACKED_FACE) {
+        patch.byte_offset = static_cast<GLintptr>(slot->first_face) *
+            CFD::WORDS_PER_FACE * sizeof(GLuint);
+        Add_Cube_Face_Records(pos, colour, patch.face_data, slot->faces);
+    }
+    else {
+        int vertex_offset = 0;
+        patch.byte_offset = static_cast<GLintptr>(slot->first_face) *
+            FACE_VERT_SIZE * sizeof(GLfloat);
+        Add_Cube_Mesh_Fast(pos, colour, patch.vertex_data, vertex_offset, slot->faces);
+    }
+    return true;
+}
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef FACE_PATCH_H
+#define FACE_PATCH_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <vector>
+#include <GLFW/glfw3.h>
+#include <GLM/glm.hpp>
+
+#include "../../CommonWD.h"
+#include "../../../Compact Data/Cube Mesh/CCMS.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int FACE_PATCH_MAX_PER_SECTION = 64;  // More edits than this rebuild the section
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: face_slot_t                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Where one voxel's faces live inside a section mesh.
+ *
+ * The full detail mesher emits every face of a voxel back to back, in
+ * cube_faces_t bit order, so a voxel only needs its first face index and the
+ * mask of faces it emitted. Slots are recorded in voxel_loc_t order, which is
+ * the order the mesher walks the section, so lookups can binary search.
+ * ============================================================================ */
+typedef struct face_slot_t {
+    uint16_t        voxel;          // voxel_loc_t location in the chunk
+    uint16_t        first_face;     // Index of the voxel's first face in the section
+    cube_faces_t    faces;          // Faces the voxel emitted
+} face_slot_t;
+
+typedef std::vector<face_slot_t> face_slots_t;
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: face_patch_t                            //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * A replacement for a contiguous byte range of a section's vertex buffer.
+ * Only the array matching the mesh format is filled. Offsets are in mesher
+ * order; a section grouped by direction maps each face through its
+ * face_order before writing it.
+ * ============================================================================ */
+typedef struct face_patch_t {
+    GLintptr                byte_offset = 0;
+    int                     first_face  = 0;    // Mesher order index of the first face
+    int                     num_faces   = 0;
+    std::vector<GLfloat>    vertex_data;    // PACKED_VERTEX
+    std::vector<GLuint >    face_data;      // PACKED_FACE
+
+    GLsizeiptr      Get_Size() const;
+    const void*     Get_Data() const;
+} face_patch_t;
+
+//----------------------------------------------------------------------------//
+//                         STRUCT: voxel_recolour_t                           //
+//----------------------------------------------------------------------------//
+typedef struct voxel_recolour_t {
+    sector_loc_t    sector;
+    chunk_loc_t     chunk;
+    glm::ivec3      local;          // Chunk local voxel position
+} voxel_recolour_t;
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+void Record_Face_Slot(
+    face_slots_t&       slots,
+    const glm::ivec3&   pos,
+    int                 first_face,
+    cube_faces_t        faces
+);
+
+const face_slot_t* Find_Face_Slot(
+    const face_slots_t& slots,
+    const glm::ivec3&   pos
+);
+
+bool Build_Recolour_Patch(
+    const face_slots_t& slots,
+    const glm::ivec3&   pos,
+    const glm::vec3&    colour,
+    mesh_format_t       format,
+    face_patch_t&       patch
+);
+
+
+#endif // !FACE_PATCH_H
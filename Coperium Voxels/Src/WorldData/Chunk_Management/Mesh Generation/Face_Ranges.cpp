@@ -0,0 +1,235 @@
+#include "Face_Ranges.h"
+
+#include <algorithm>
+#include <cstring>
+
+/* ============================================================================
+ * --------------------------- Face_Direction
+ * Reads the direction (cube_faces_t shift) of one built face back out of the
+ * mesh data, so any generator's output can be grouped afterwards.
+ *
+ * ------ Parameters ------
+ * vertex_face : The face's FACE_VERT_SIZE floats (PACKED_VERTEX)
+ * face_record : The face's CFD record (PACKED_FACE)
+ * ============================================================================ */
+int Face_Direction(const GLfloat* vertex_face) {
+    const glm::vec3 n = CND(vertex_face[2]).Unpack();
+    const glm::vec3 a = glm::abs(n);
+
+    if (a.x >= a.y && a.x >= a.z) return n.x > 0.0f ? RIGHT_SHIFT : LEFT_SHIFT;
+    if (a.y >= a.z)               return n.y > 0.0f ? TOP_SHIFT   : BOTTOM_SHIFT;
+    return                               n.z > 0.0f ? FRONT_SHIFT : BACK_SHIFT;
+}
+
+int Face_Direction(const GLuint* face_record) {
+    return CFD(face_record[0], face_record[1]).Get_Face();
+}
+
+/* ============================================================================
+ * --------------------------- Face_Plane
+ * Returns the chunk local plane a face lies on along its normal, as a whole
+ * number: a voxel's +X face at x = 3 lies on plane 4, its -X face on 3.
+ *
+ * ------ Parameters ------
+ * vertex_face : The face's FACE_VERT_SIZE floats (PACKED_VERTEX)
+ * face_record : The face's CFD record (PACKED_FACE)
+ * direction   : The face's direction, from Face_Direction
+ * ============================================================================ */
+int Face_Plane(const GLfloat* vertex_face, int direction) {
+    const CLD corner(vertex_face[0]);
+    const float plane =
+        direction == LEFT_SHIFT  || direction == RIGHT_SHIFT  ? corner.Get_X() :
+        direction == TOP_SHIFT   || direction == BOTTOM_SHIFT ? corner.Get_Y() :
+                                                                corner.Get_Z();
+    return static_cast<int>(std::lround(plane + 0.5f));
+}
+
+int Face_Plane(const GLuint* face_record, int direction) {
+    const CFD face(face_record[0], face_record[1]);
+    switch (direction) {
+        case RIGHT_SHIFT : return face.Get_X() + face.Get_Scale();
+        case LEFT_SHIFT  : return face.Get_X();
+        case TOP_SHIFT   : return face.Get_Y() + face.Get_Scale();
+        case BOTTOM_SHIFT: return face.Get_Y();
+        case FRONT_SHIFT : return face.Get_Z() + face.Get_Scale();
+        default          : return face.Get_Z();
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Group_Faces_By_Direction
+ * Stable counting sort of a section's faces by direction. One pass counts
+ * each direction, a second copies every face to its group.
+ *
+ * With depth_sort the key also holds the face's plane, nearest first for a
+ * camera the faces point towards: falling planes for +X / +Y / +Z faces,
+ * rising for the others. A face can only be seen from its front, so this one
+ * order is near to far from every camera that sees the group at all.
+ *
+ * ------ Parameters ------
+ * in         : The built faces, in mesher order
+ * out        : Receives the grouped faces, same size as in
+ * num_faces  : Number of faces
+ * format     : Layout of the faces
+ * ranges     : Receives where each direction ended up
+ * face_order : Optional, receives the grouped index of every input face so
+ *              slot maps recorded in mesher order still find their faces
+ * depth_sort : Also order each group by plane, near to far
+ * ============================================================================ */
+void Group_Faces_By_Direction(
+    const void*             in,
+    void*                   out,
+    int                     num_faces,
+    mesh_format_t           format,
+    face_ranges_t&          ranges,
+    std::vector<uint16_t>*  face_order,
+    bool                    depth_sort
+) {
+    const bool   packed_face = format == mesh_format_t::PACKED_FACE;
+    const size_t face_bytes  = packed_face
+        ? CFD::WORDS_PER_FACE * sizeof(GLuint)
+        : FACE_VERT_SIZE      * sizeof(GLfloat);
+
+    const char* src = static_cast<const char*>(in);
+    char*       dst = static_cast<char*>(out);
+
+    const int depth_buckets = depth_sort ? FACE_DEPTH_BUCKETS : 1;
+
+    // Bucket = direction * depth_buckets + near to far rank of the plane
+    auto bucket = [&](int face) {
+        const char* data = src + face * face_bytes;
+        const int   dir  = packed_face
+            ? Face_Direction(reinterpret_cast<const GLuint* >(data))
+            : Face_Direction(reinterpret_cast<const GLfloat*>(data));
+        if (!depth_sort) return dir;
+
+        const int  plane = packed_face
+            ? Face_Plane(reinterpret_cast<const GLuint* >(data), dir)
+            : Face_Plane(reinterpret_cast<const GLfloat*>(data), dir);
+        const bool positive = dir == RIGHT_SHIFT || dir == TOP_SHIFT || dir == FRONT_SHIFT;
+        const int  rank     = positive ? CHUNK_SIZE_Y - plane : plane;
+        return dir * depth_buckets + glm::clamp(rank, 0, depth_buckets - 1);
+    };
+
+    int next[NUM_FACES * FACE_DEPTH_BUCKETS] = { 0 };
+    for (int face = 0; face < num_faces; ++face) {
+        ++next[bucket(face)];
+    }
+
+    ranges = face_ranges_t();
+    for (int d = 0, first = 0; d < NUM_FACES; ++d) {
+        ranges.first[d] = first;
+        for (int b = d * depth_buckets; b < (d + 1) * depth_buckets; ++b) {
+            const int count = next[b];
+            next[b] = first;
+            first  += count;
+        }
+        ranges.count[d] = first - ranges.first[d];
+    }
+
+    if (face_order) face_order->resize(static_cast<size_t>(num_faces));
+    for (int face = 0; face < num_faces; ++face) {
+        const int to = next[bucket(face)]++;
+        std::memcpy(dst + to * face_bytes, src + face * face_bytes, face_bytes);
+        if (face_order) (*face_order)[face] = static_cast<uint16_t>(to);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Visible_Face_Directions
+ * Returns the face directions of a box's contents that can face the camera.
+ * A +X face can only be seen from larger X than its plane, and no +X plane
+ * lies below the box's minimum X, so the test is exact per axis. A camera
+ * inside the box's slab on an axis sees both directions of that axis.
+ *
+ * ------ Parameters ------
+ * camera  : Camera position
+ * box_min : Minimum corner of everything in the mesh
+ * box_max : Maximum corner of everything in the mesh
+ * ============================================================================ */
+cube_faces_t Visible_Face_Directions(
+    const glm::vec3&    camera,
+    const glm::vec3&    box_min,
+    const glm::vec3&    box_max
+) {
+    using u8 = std::underlying_type_t<cube_faces_t>;
+    return static_cast<cube_faces_t>(
+        (static_cast<u8>(camera.x > box_min.x) << RIGHT_SHIFT ) |
+        (static_cast<u8>(camera.x < box_max.x) << LEFT_SHIFT  ) |
+        (static_cast<u8>(camera.y > box_min.y) << TOP_SHIFT   ) |
+        (static_cast<u8>(camera.y < box_max.y) << BOTTOM_SHIFT) |
+        (static_cast<u8>(camera.z > box_min.z) << FRONT_SHIFT ) |
+        (static_cast<u8>(camera.z < box_max.z) << BACK_SHIFT  )
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Face_Draw_Order
+ * Orders the six directions for drawing, the ones facing the camera most
+ * squarely first. Those cover the most screen for their face count, so
+ * drawing them first lets early depth testing reject more of the rest.
+ *
+ * ------ Parameters ------
+ * view_front : The camera's view direction
+ * order      : Receives the directions (cube_faces_t shifts), first to last
+ * ============================================================================ */
+void Face_Draw_Order(const glm::vec3& view_front, int order[NUM_FACES]) {
+    const glm::vec3 normals[NUM_FACES] = {
+        { 0, 0, 1 }, { 0, 0, -1 },      // FRONT, BACK
+        { -1, 0, 0 }, { 1, 0, 0 },      // LEFT , RIGHT
+        { 0, 1, 0 }, { 0, -1, 0 },      // TOP  , BOTTOM
+    };
+
+    float facing[NUM_FACES];
+    for (int d = 0; d < NUM_FACES; ++d) {
+        facing[d] = -glm::dot(normals[d], view_front);
+        order [d] = d;
+    }
+    std::stable_sort(order, order + NUM_FACES, [&](int a, int b) { return facing[a] > facing[b]; });
+}
+
+/* ============================================================================
+ * --------------------------- Face_Runs
+ * Turns the wanted directions of a section into the ranges of faces to
+ * draw, in draw order. Directions that follow each other in the buffer
+ * become one run, so all six in buffer order are a single run.
+ *
+ * ------ Parameters ------
+ * ranges    : Where each direction sits in the section mesh
+ * num_faces : Faces in the section mesh
+ * faces     : The face directions to draw
+ * order     : Optional order to draw the directions in (cube_faces_t
+ *             shifts); buffer order when null
+ * runs      : Receives the runs
+ *
+ * ------ Returns ------
+ * The number of runs written
+ * ============================================================================ */
+int Face_Runs(
+    const face_ranges_t&    ranges,
+    int                     num_faces,
+    cube_faces_t            faces,
+    const int*              order,
+    face_run_t              (&runs)[NUM_FACES]
+) {
+    if (num_faces <= 0) return 0;
+    if (faces == ALL_FACES && !order) {
+        runs[0] = { 0, num_faces };
+        return 1;
+    }
+
+    int num_runs = 0;
+    for (int i = 0; i < NUM_FACES; ++i) {
+        const int d = order ? order[i] : i;
+        if (!(faces & (1 << d)) || ranges.count[d] == 0) continue;
+
+        face_run_t* last = num_runs > 0 ? &runs[num_runs - 1] : nullptr;
+        if (last && ranges.first[d] == last->first + last->count) {
+            last->count += ranges.count[d];
+        }
+        else {
+            runs[num_runs++] = { ranges.first[d], ranges.count[d] };
+        }
+    }
+    return num_runs;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#ifndef FACE_RANGES_H
+#define FACE_RANGES_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <vector>
+#include <GLFW/glfw3.h>
+#include <GLM/glm.hpp>
+
+#include "../../CommonWD.h"
+#include "../../../Compact Data/Cube Mesh/CCMS.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int FACE_DEPTH_BUCKETS = CHUNK_SIZE_Y + 1;   // Face planes 0 .. CHUNK_SIZE_Y
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: face_ranges_t                            //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Where each face direction sits in a section mesh.
+ *
+ * Section meshes are stored grouped by direction, in cube_faces_t shift
+ * order (FRONT, BACK, LEFT, RIGHT, TOP, BOTTOM). Inside a group faces keep
+ * the mesher's scan order, or when depth sorted run nearest plane first as
+ * seen from the side the faces point to. Indices are in faces, not bytes.
+ * ============================================================================ */
+typedef struct face_ranges_t {
+    int first[NUM_FACES] = { 0 };   // First face of each direction
+    int count[NUM_FACES] = { 0 };   // Faces of each direction
+} face_ranges_t;
+
+//----------------------------------------------------------------------------//
+//                             STRUCT: face_run_t                             //
+//----------------------------------------------------------------------------//
+typedef struct face_run_t {
+    int first = 0;                  // First face of the run
+    int count = 0;                  // Faces in the run
+} face_run_t;
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+int Face_Direction(const GLfloat* vertex_face);
+int Face_Direction(const GLuint*  face_record);
+int Face_Plane    (const GLfloat* vertex_face, int direction);
+int Face_Plane    (const GLuint*  face_record, int direction);
+
+void Group_Faces_By_Direction(
+    const void*             in,
+    void*                   out,
+    int                     num_faces,
+    mesh_format_t           format,
+    face_ranges_t&          ranges,
+    std::vector<uint16_t>*  face_order,
+    bool                    depth_sort = false
+);
+
+cube_faces_t Visible_Face_Directions(
+    const glm::vec3&    camera,
+    const glm::vec3&    box_min,
+    const glm::vec3&    box_max
+);
+
+void Face_Draw_Order(const glm::vec3& view_front, int order[NUM_FACES]);
+int  Face_Runs(
+    const face_ranges_t&    ranges,
+    int                     num_faces,
+    cube_faces_t            faces,
+    const int*              order,
+    face_run_t              (&runs)[NUM_FACES]
+);
+
+#endif // !FACE_RANGES_H
@@ -0,0 +1,555 @@
+#include "Far_Terrain.h"
+
+#include <chrono>
+#include <climits>
+#include <fstream>
+#include <iostream>
+
+/* ============================================================================
+ * --------------------------- Column_Index
+ * Index of a chunk column in a sector's dirty column set.
+ * ============================================================================ */
+static inline int Column_Index(int x, int z) {
+    return x * NUM_CHUNKS_Z + z;
+}
+
+/* ============================================================================
+ * --------------------------- Sector_Origin
+ * World position of a sector's first voxel.
+ * ============================================================================ */
+static inline glm::vec3 Sector_Origin(const sector_loc_t& sector) {
+    return glm::vec3(sector.X() * SECTR_SIZE_X, 0.0f, sector.Z() * SECTR_SIZE_Z);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Sector
+ * The heightfield of a sector, added empty if it has none yet.
+ * ============================================================================ */
+far_sector_t& Far_Terrain::Get_Sector(const sector_loc_t& sector) {
+    auto [it, added] = sectors.try_emplace(sector.location);
+    if (added) it->second.sector = sector;
+    return it->second;
+}
+
+/* ============================================================================
+ * --------------------------- Sector_Distance
+ * Horizontal distance from the camera to a sector's square (0 inside).
+ * ============================================================================ */
+float Far_Terrain::Sector_Distance(const sector_loc_t& sector, const glm::vec3& camera) {
+    const glm::vec2 box_min = glm::vec2(sector.X() * SECTR_SIZE_X, sector.Z() * SECTR_SIZE_Z) - 0.5f;
+    const glm::vec2 box_max = box_min + glm::vec2(SECTR_SIZE_X, SECTR_SIZE_Z);
+    const glm::vec2 camera_xz(camera.x, camera.z);
+    return glm::length(camera_xz - glm::clamp(camera_xz, box_min, box_max));
+}
+
+/* ============================================================================
+ * --------------------------- Scan_Column
+ * Reads the cells over one chunk column from its loaded chunks, top down.
+ * Chunks are skipped a LOD_8 mip cell at a time until a solid block is
+ * found; only that block's layers are then read voxel by voxel. A cell
+ * whose previous top lies in a chunk that is not loaded keeps its value.
+ *
+ * ------ Parameters ------
+ * world  : The world holding the chunks
+ * sector : Sector holding the column
+ * column : Chunk x / z within the sector
+ * cells  : The sector's heightfield, updated in place
+ * loaded : Set to whether any chunk of the column is loaded (optional)
+ *
+ * ------ Returns ------
+ * true if any of the column's cells changed
+ * ============================================================================ */
+bool Far_Terrain::Scan_Column(
+    World&              world,
+    const sector_loc_t& sector,
+    const glm::ivec2&   column,
+    far_cells_t&        cells,
+    bool*               loaded
+) {
+    constexpr int BLOCKS_Y = CHUNK_SIZE_Y / FAR_TERRAIN_CELL_SIZE;
+
+    chunks_t* chunks = nullptr;
+    std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(sector);
+    if (sector_ptr && *sector_ptr) chunks = (*sector_ptr)->Get_All_Chunks();
+
+    std::array<std::shared_ptr<Chunk>*, NUM_CHUNKS_Y> stack{};
+    bool any_loaded = false;
+    for (int cy = MIN_ID_C_Y; chunks && cy <= MAX_ID_C_Y; ++cy) {
+        stack[cy - MIN_ID_C_Y] = chunks->Find(chunk_loc_t::Compact(glm::ivec3(column.x, cy, column.y)));
+        any_loaded |= stack[cy - MIN_ID_C_Y] && *stack[cy - MIN_ID_C_Y];
+    }
+    if (loaded) *loaded = any_loaded;
+
+    bool changed = false;
+    for (int i = 0; i < FAR_TERRAIN_COLUMN_CELLS; ++i) {
+        for (int j = 0; j < FAR_TERRAIN_COLUMN_CELLS; ++j) {
+            far_cell_t& cell = cells[Far_Cell_Index(
+                column.x * FAR_TERRAIN_COLUMN_CELLS + i,
+                column.y * FAR_TERRAIN_COLUMN_CELLS + j
+            )];
+            const glm::ivec3 base(i * FAR_TERRAIN_CELL_SIZE, 0, j * FAR_TERRAIN_CELL_SIZE);
+
+            far_cell_t found;
+            bool decided = false;
+            for (int cy = MAX_ID_C_Y; cy >= MIN_ID_C_Y && !decided; --cy) {
+                std::shared_ptr<Chunk>* chunk_ptr = stack[cy - MIN_ID_C_Y];
+                if (!chunk_ptr || !*chunk_ptr) {
+                    // Rounds towards negative infinity, like the chunk ids below 0
+                    const int old_chunk = cell.height == FAR_TERRAIN_EMPTY ? INT_MIN :
+                        (cell.height < 0 ? cell.height - (CHUNK_SIZE_Y - 1) : cell.height) / CHUNK_SIZE_Y;
+                    if (old_chunk == cy) {
+                        found   = cell;
+                        decided = true;
+                    }
+                    continue;
+                }
+
+                Chunk& chunk = **chunk_ptr;
+                const Chunk_Mip& mip = chunk.Get_Mip();
+                for (int block = BLOCKS_Y - 1; block >= 0 && !decided; --block) {
+                    if (mip.Get_Cell(base + glm::ivec3(0, block * FAR_TERRAIN_CELL_SIZE, 0), FAR_TERRAIN_CELL_SIZE).count == 0) {
+                        continue;
+                    }
+
+                    for (int y = block * FAR_TERRAIN_CELL_SIZE + FAR_TERRAIN_CELL_SIZE - 1;
+                         y >= block * FAR_TERRAIN_CELL_SIZE && !decided; --y) {
+                        glm::ivec3 sum(0);
+                        int        solid = 0;
+                        for (int x = 0; x < FAR_TERRAIN_CELL_SIZE; ++x) {
+                            for (int z = 0; z < FAR_TERRAIN_CELL_SIZE; ++z) {
+                                const Voxel* voxel = chunk.Get_Voxel(base + glm::ivec3(x, y, z));
+                                if (!voxel->IsSolid()) continue;
+                                sum += glm::ivec3(voxel->GetColour());
+                                ++solid;
+                            }
+                        }
+                        if (solid == 0) continue;
+
+                        // 4-bit channels to 0 .. 255, rounded
+                        const glm::ivec3 colour = (sum * 17 + solid / 2) / solid;
+                        found.height = static_cast<int16_t>(cy * CHUNK_SIZE_Y + y);
+                        found.r      = static_cast<uint8_t>(colour.r);
+                        found.g      = static_cast<uint8_t>(colour.g);
+                        found.b      = static_cast<uint8_t>(colour.b);
+                        decided      = true;
+                    }
+                }
+            }
+
+            if (!(found == cell)) {
+                cell    = found;
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+/* ============================================================================
+ * --------------------------- Build_Grid
+ * Builds a sector's grid mesh: one vertex per cell corner, lifted to the
+ * average top surface of the non empty cells around it and coloured the
+ * same way, and two triangles per non empty cell. Normals come from the
+ * height differences between neighbouring corners. Positions are relative
+ * to the sector with the half voxel shift every chunk mesh has.
+ *
+ * ------ Parameters ------
+ * cells    : The sector's heightfield
+ * vertices : Filled with FAR_TERRAIN_VERT_SIZE floats per corner
+ * indices  : Filled with the triangles
+ *
+ * ------ Returns ------
+ * The number of indices built
+ * ============================================================================ */
+int Far_Terrain::Build_Grid(
+    const far_cells_t&      cells,
+    std::vector<GLfloat>&   vertices,
+    std::vector<GLuint>&    indices
+) {
+    constexpr int CORNERS = FAR_TERRAIN_CELLS + 1;
+
+    thread_local std::array<float    , CORNERS * CORNERS> heights;
+    thread_local std::array<glm::vec3, CORNERS * CORNERS> colours;
+
+    for (int a = 0; a < CORNERS; ++a) {
+        for (int b = 0; b < CORNERS; ++b) {
+            float     height = 0.0f;
+            glm::vec3 colour(0.0f);
+            int       count  = 0;
+            for (int x = a - 1; x <= a; ++x) {
+                for (int z = b - 1; z <= b; ++z) {
+                    if (x < 0 || x >= FAR_TERRAIN_CELLS || z < 0 || z >= FAR_TERRAIN_CELLS) continue;
+                    const far_cell_t& cell = cells[Far_Cell_Index(x, z)];
+                    if (cell.height == FAR_TERRAIN_EMPTY) continue;
+                    height += cell.height + 0.5f;
+                    colour += glm::vec3(cell.r, cell.g, cell.b);
+                    ++count;
+                }
+            }
+            heights[a * CORNERS + b] = count ? height / count : 0.0f;
+            colours[a * CORNERS + b] = count ? colour / (255.0f * count) : glm::vec3(0.0f);
+        }
+    }
+
+    vertices.clear();
+    indices .clear();
+    vertices.reserve(static_cast<size_t>(CORNERS) * CORNERS * FAR_TERRAIN_VERT_SIZE);
+
+    auto height_at = [&](int a, int b) {
+        return heights[glm::clamp(a, 0, CORNERS - 1) * CORNERS + glm::clamp(b, 0, CORNERS - 1)];
+    };
+
+    for (int a = 0; a < CORNERS; ++a) {
+        for (int b = 0; b < CORNERS; ++b) {
+            const glm::vec3 normal = glm::normalize(glm::vec3(
+                height_at(a - 1, b) - height_at(a + 1, b),
+                2.0f * FAR_TERRAIN_CELL_SIZE,
+                height_at(a, b - 1) - height_at(a, b + 1)
+            ));
+            const glm::vec3& colour = colours[a * CORNERS + b];
+
+            vertices.insert(vertices.end(), {
+                a * FAR_TERRAIN_CELL_SIZE - 0.5f, heights[a * CORNERS + b], b * FAR_TERRAIN_CELL_SIZE - 0.5f,
+                colour.r, colour.g, colour.b,
+                normal.x, normal.y, normal.z
+            });
+        }
+    }
+
+    for (int x = 0; x < FAR_TERRAIN_CELLS; ++x) {
+        for (int z = 0; z < FAR_TERRAIN_CELLS; ++z) {
+            if (cells[Far_Cell_Index(x, z)].height == FAR_TERRAIN_EMPTY) continue;
+
+            const GLuint c00 = static_cast<GLuint>( x      * CORNERS + z    );
+            const GLuint c01 = static_cast<GLuint>( x      * CORNERS + z + 1);
+            const GLuint c10 = static_cast<GLuint>((x + 1) * CORNERS + z    );
+            const GLuint c11 = static_cast<GLuint>((x + 1) * CORNERS + z + 1);
+
+            // Clockwise seen from above, the front face winding the app uses
+            indices.insert(indices.end(), { c00, c11, c01, c00, c10, c11 });
+        }
+    }
+    return static_cast<int>(indices.size());
+}
+
+/* ============================================================================
+ * --------------------------- Mark_Dirty
+ * Flags the column holding a chunk to be scanned again, adding the sector
+ * if this is its first chunk.
+ * ============================================================================ */
+void Far_Terrain::Mark_Dirty(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    Get_Sector(sector).dirty_columns.set(Column_Index(chunk.X(), chunk.Z()));
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every heightfield and mesh. Saved heightfields stay on disk.
+ * ============================================================================ */
+void Far_Terrain::Clear() {
+    sectors.clear();
+    held_columns.clear();
+}
+
+/* ============================================================================
+ * --------------------------- Update
+ * Scans dirty columns and then rebuilds the grid mesh of every sector whose
+ * cells changed and has no columns left to scan, until `budget_ms` is spent
+ * (at least one column or mesh per call so the work always moves on). The
+ * old mesh is drawn until the new one is uploaded. Scanned columns that
+ * Has_Column now holds are listed in Get_Held_Columns until the next call.
+ *
+ * ------ Parameters ------
+ * world     : The world holding the chunks
+ * upload    : false to only build on the CPU (headless checks)
+ * budget_ms : Time allowed this call (0 = no limit)
+ * ============================================================================ */
+void Far_Terrain::Update(World& world, bool upload, float budget_ms) {
+    const auto start = std::chrono::steady_clock::now();
+    stats.columns_scanned = 0;
+    stats.columns_pending = 0;
+    stats.meshes_built    = 0;
+    stats.elapsed_ms      = 0.0;
+    held_columns.clear();
+
+    auto out_of_time = [&]() {
+        if (budget_ms <= 0.0f || stats.columns_scanned + stats.meshes_built == 0) return false;
+        stats.elapsed_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+        return stats.elapsed_ms >= budget_ms;
+    };
+
+    for (auto& [key, entry] : sectors) {
+        for (int column = 0; column < NUM_CHUNKS_X * NUM_CHUNKS_Z && entry.dirty_columns.any(); ++column) {
+            if (!entry.dirty_columns.test(column) || out_of_time()) continue;
+
+            const glm::ivec2 location = { column / NUM_CHUNKS_Z, column % NUM_CHUNKS_Z };
+            bool loaded = false;
+            if (Scan_Column(world, entry.sector, location, entry.cells, &loaded)) {
+                entry.mesh_dirty = true;
+                entry.unsaved    = true;
+            }
+            if (loaded && !entry.known_columns.test(column)) {
+                entry.known_columns.set(column);
+                entry.unsaved = true;
+            }
+            if (entry.known_columns.test(column)) {
+                held_columns.push_back({ entry.sector, chunk_loc_t::Compact(glm::ivec3(location.x, 0, location.y)) });
+            }
+            entry.dirty_columns.reset(column);
+            ++stats.columns_scanned;
+        }
+        stats.columns_pending += static_cast<int>(entry.dirty_columns.count());
+
+        if (!entry.mesh_dirty || entry.dirty_columns.any() || out_of_time()) continue;
+
+        entry.num_indices = Build_Grid(entry.cells, vertex_scratch, index_scratch);
+        if (upload) {
+            if (entry.num_indices == 0) {
+                entry.mesh.Clear_Mesh();
+            }
+            else {
+                entry.mesh.Configure_Mesh(
+                    vertex_scratch.data(), sizeof(GLfloat), static_cast<GLsizei>(vertex_scratch.size()),
+                    GL_FLOAT, FAR_TERRAIN_VERT_SIZE,
+                    index_scratch.data(), sizeof(GLuint), static_cast<GLsizei>(index_scratch.size())
+                );
+                entry.mesh.Add_Vertex_Set(0, 3, 0);
+                entry.mesh.Add_Vertex_Set(1, 3, 3);
+                entry.mesh.Add_Vertex_Set(2, 3, 6);
+            }
+        }
+        entry.built      = true;
+        entry.mesh_dirty = false;
+        ++stats.meshes_built;
+    }
+
+    stats.sectors    = static_cast<int>(sectors.size());
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+}
+
+/* ============================================================================
+ * --------------------------- Select
+ * Flags every built, non empty sector further than `distance` from the
+ * camera to be drawn as terrain this frame.
+ *
+ * ------ Returns ------
+ * The number of sectors selected
+ * ============================================================================ */
+int Far_Terrain::Select(const glm::vec3& camera, float distance) {
+    stats.sectors_drawn = 0;
+    for (auto& [key, entry] : sectors) {
+        entry.drawn = entry.built && entry.num_indices > 0 &&
+                      Sector_Distance(entry.sector, camera) > distance;
+        if (entry.drawn) ++stats.sectors_drawn;
+    }
+    return stats.sectors_drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Draw
+ * Draws the sectors picked by the last Select, one call each, moving every
+ * grid to its sector through the vertex_offset uniform.
+ *
+ * ------ Parameters ------
+ * shader        : The bound terrain shader
+ * vertex_offset : Location of its vertex_offset uniform
+ *
+ * ------ Returns ------
+ * The number of sectors drawn
+ * ============================================================================ */
+int Far_Terrain::Draw(const Coil::Shader& shader, GLuint vertex_offset) {
+    int drawn = 0;
+    stats.triangles_drawn = 0;
+
+    for (const auto& [key, entry] : sectors) {
+        if (!entry.drawn) continue;
+
+        shader.Set_Vec3(vertex_offset, Sector_Origin(entry.sector));
+        entry.mesh.Draw_Mesh(false);
+
+        ++drawn;
+        stats.triangles_drawn += entry.num_indices / 3;
+    }
+    return drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Is_Drawn
+ * Whether a sector was picked by the last Select.
+ * ============================================================================ */
+bool Far_Terrain::Is_Drawn(const sector_loc_t& sector) const {
+    auto it = sectors.find(sector.location);
+    return it != sectors.end() && it->second.drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Has_Column
+ * Whether the heightfield holds the column of `chunk`: it has been read
+ * from its chunks (now or before a save) and no change is waiting to be
+ * scanned. Such a column can stand in for its chunks.
+ * ============================================================================ */
+bool Far_Terrain::Has_Column(const sector_loc_t& sector, const chunk_loc_t& chunk) const {
+    auto it = sectors.find(sector.location);
+    if (it == sectors.end()) return false;
+
+    const int column = Column_Index(chunk.X(), chunk.Z());
+    return it->second.known_columns.test(column) && !it->second.dirty_columns.test(column);
+}
+
+/* ============================================================================
+ * --------------------------- Save
+ * Writes every heightfield changed since the last save to
+ * <world_dir>/<sector>/FAR_TERRAIN_FILE.
+ *
+ * ------ Returns ------
+ * The number of files written
+ * ============================================================================ */
+int Far_Terrain::Save(const std::filesystem::path& world_dir) {
+    int saved = 0;
+    for (auto& [key, entry] : sectors) {
+        if (!entry.unsaved) continue;
+
+        const std::filesystem::path sector_dir = world_dir / std::to_string(entry.sector.location);
+        std::filesystem::create_directories(sector_dir);
+
+        if (Save_File(sector_dir / FAR_TERRAIN_FILE, entry)) {
+            entry.unsaved = false;
+            ++saved;
+        }
+    }
+    return saved;
+}
+
+/* ============================================================================
+ * --------------------------- Load
+ * Reads every saved heightfield under `world_dir`, replacing the cells of
+ * sectors already known. Their meshes are built on the next Update.
+ *
+ * ------ Returns ------
+ * The number of files read
+ * ============================================================================ */
+int Far_Terrain::Load(const std::filesystem::path& world_dir) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(world_dir, ec)) return 0;
+
+    int loaded = 0;
+    for (const auto& dir : std::filesystem::directory_iterator(world_dir, ec)) {
+        const std::filesystem::path file = dir.path() / FAR_TERRAIN_FILE;
+        if (!dir.is_directory() || !std::filesystem::exists(file)) continue;
+
+        far_sector_t read;
+        if (!Load_File(file, read)) {
+            std::cerr << "Error: Could not read far terrain: " << file << std::endl;
+            continue;
+        }
+
+        far_sector_t& entry = Get_Sector(read.sector);
+        entry.cells          = read.cells;
+        entry.known_columns |= read.known_columns;
+        entry.mesh_dirty = true;
+        entry.unsaved    = false;
+        ++loaded;
+    }
+    return loaded;
+}
+
+/* ============================================================================
+ * --------------------------- Set_Deferred
+ * Records how many dirty chunks the world left unmeshed because their
+ * sector is drawn as terrain.
+ * ============================================================================ */
+void Far_Terrain::Set_Deferred(int chunks) {
+    stats.chunks_deferred = chunks;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Stats
+ * Returns last frame's scan, build and draw counts.
+ * ============================================================================ */
+const far_terrain_stats_t& Far_Terrain::Get_Stats() const {
+    return stats;
+}
+
+const std::vector<far_column_t>& Far_Terrain::Get_Held_Columns() const {
+    return held_columns;
+}
+
+//----------------------------------------------------------------------------//
+//                                 FILE I/O                                   //
+//----------------------------------------------------------------------------//
+template <typename T>
+static void Write_Value(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool Read_Value(std::ifstream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+/* ============================================================================
+ * --------------------------- Save_File
+ * Writes one sector's heightfield to disk.
+ *
+ * ------ Returns ------
+ * true if the whole file was written
+ * ============================================================================ */
+bool Far_Terrain::Save_File(const std::filesystem::path& file, const far_sector_t& entry) {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Error: Could not open far terrain for writing: " << file << std::endl;
+        return false;
+    }
+
+    Write_Value(out, FAR_TERRAIN_MAGIC);
+    Write_Value(out, FAR_TERRAIN_VERSION);
+    Write_Value(out, entry.sector.location);
+    for (const far_cell_t& cell : entry.cells) {
+        Write_Value(out, cell.height);
+        Write_Value(out, cell.r);
+        Write_Value(out, cell.g);
+        Write_Value(out, cell.b);
+    }
+    // The last word's spare bits stay zero
+    uint64_t words[FAR_TERRAIN_COLUMN_WORDS] = {};
+    for (size_t column = 0; column < entry.known_columns.size(); ++column) {
+        if (entry.known_columns.test(column)) words[column / 64] |= uint64_t(1) << (column % 64);
+    }
+    for (uint64_t bits : words) Write_Value(out, bits);
+    return static_cast<bool>(out);
+}
+
+/* ============================================================================
+ * --------------------------- Load_File
+ * Reads one sector's heightfield, including which sector it belongs to.
+ *
+ * ------ Returns ------
+ * false if the file is missing, truncated or from another version
+ * ============================================================================ */
+bool Far_Terrain::Load_File(const std::filesystem::path& file, far_sector_t& entry) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) return false;
+
+    uint32_t magic = 0, version = 0;
+    if (!Read_Value(in, magic  ) || magic   != FAR_TERRAIN_MAGIC  ) return false;
+    if (!Read_Value(in, version) || version != FAR_TERRAIN_VERSION) return false;
+    if (!Read_Value(in, entry.sector.location)) return false;
+
+    for (far_cell_t& cell : entry.cells) {
+        if (!Read_Value(in, cell.height) || !Read_Value(in, cell.r) ||
+            !Read_Value(in, cell.g)      || !Read_Value(in, cell.b)) return false;
+    }
+
+    uint64_t words[FAR_TERRAIN_COLUMN_WORDS] = {};
+    for (uint64_t& bits : words) {
+        if (!Read_Value(in, bits)) return false;
+    }
+    entry.known_columns.reset();
+    for (size_t column = 0; column < entry.known_columns.size(); ++column) {
+        if (words[column / 64] >> (column % 64) & 1) entry.known_columns.set(column);
+    }
+    return true;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#ifndef FAR_TERRAIN_H
+#define FAR_TERRAIN_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GLM/glm.hpp>
+
+#include "../../World.h"
+#include <COIL/Mesh/Basic_Mesh.h>
+#include <COIL/Shaders/Shader.h>
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int FAR_TERRAIN_CELL_SIZE     = 8;    // Voxels per heightfield cell side (the LOD_8 mip level)
+constexpr int FAR_TERRAIN_CELLS         = SECTR_SIZE_X / FAR_TERRAIN_CELL_SIZE;     // 64 per sector side
+constexpr int FAR_TERRAIN_COLUMN_CELLS  = CHUNK_SIZE_X / FAR_TERRAIN_CELL_SIZE;     //  2 per chunk side
+constexpr int FAR_TERRAIN_VERT_SIZE     = 9;    // Floats per vertex: position, colour, normal
+constexpr int FAR_TERRAIN_COLUMN_WORDS  = (NUM_CHUNKS_X * NUM_CHUNKS_Z + 63) / 64;   // Known column bits on disk
+
+constexpr int16_t  FAR_TERRAIN_EMPTY    = INT16_MIN;    // Cell with no solid voxel
+constexpr float    FAR_TERRAIN_MARGIN   = 128.0f;       // Chunks this much inside the distance are still meshed
+
+constexpr uint32_t FAR_TERRAIN_MAGIC    = 0x54465643;   // "CVFT"
+constexpr uint32_t FAR_TERRAIN_VERSION  = 2;
+static const std::string FAR_TERRAIN_FILE = "far_terrain.hf";
+
+static_assert(SECTR_SIZE_X == SECTR_SIZE_Z && CHUNK_SIZE_X == CHUNK_SIZE_Z,
+              "Far terrain assumes square sectors and chunks");
+static_assert(CHUNK_SIZE_X % FAR_TERRAIN_CELL_SIZE == 0 && CHUNK_SIZE_Y % FAR_TERRAIN_CELL_SIZE == 0,
+              "Far terrain cells must tile a chunk");
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: far_cell_t                              //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One column of FAR_TERRAIN_CELL_SIZE^2 voxels seen from above: the world y
+ * of its highest solid voxel and the average colour of the solid voxels on
+ * that layer (0 .. 255 per channel).
+ * ============================================================================ */
+typedef struct far_cell_t {
+    int16_t height  = FAR_TERRAIN_EMPTY;
+    uint8_t r       = 0;
+    uint8_t g       = 0;
+    uint8_t b       = 0;
+
+    bool operator==(const far_cell_t&) const = default;
+} far_cell_t;
+
+typedef std::array<far_cell_t, FAR_TERRAIN_CELLS * FAR_TERRAIN_CELLS> far_cells_t;
+
+// Index of a cell in a sector's heightfield
+inline int Far_Cell_Index(int x, int z) {
+    return x * FAR_TERRAIN_CELLS + z;
+}
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: far_sector_t                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * The heightfield of one sector and the grid mesh made from it. Cells
+ * outlive the chunks they were read from, so a sector can be drawn with
+ * none of its chunks loaded. Never copied: the mesh owns GL objects.
+ * ============================================================================ */
+typedef struct far_sector_t {
+    sector_loc_t        sector;
+    far_cells_t         cells;
+    std::bitset<NUM_CHUNKS_X * NUM_CHUNKS_Z> dirty_columns; // Chunk columns to scan again
+    std::bitset<NUM_CHUNKS_X * NUM_CHUNKS_Z> known_columns; // Columns read from their chunks at least once
+    Coil::Basic_Mesh    mesh;
+    int                 num_indices = 0;
+    bool                built       = false;    // mesh describes the cells (maybe stale)
+    bool                mesh_dirty  = true;     // Cells changed since the build
+    bool                unsaved     = false;    // Cells changed since the last save
+    bool                drawn       = false;    // Drawn in place of its chunks this frame
+} far_sector_t;
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: far_column_t                             //
+//----------------------------------------------------------------------------//
+// One chunk column of a sector; the chunk location's y is always 0
+typedef struct far_column_t {
+    sector_loc_t    sector;
+    chunk_loc_t     column;
+} far_column_t;
+
+//----------------------------------------------------------------------------//
+//                        STRUCT: far_terrain_stats_t                         //
+//----------------------------------------------------------------------------//
+typedef struct far_terrain_stats_t {
+    int     sectors         = 0;    // Sectors with a heightfield
+    int     columns_scanned = 0;    // Chunk columns read this frame
+    int     columns_pending = 0;    // Dirty columns left for later frames
+    int     meshes_built    = 0;    // Grid meshes rebuilt this frame
+    int     sectors_drawn   = 0;    // Sectors drawn as terrain this frame
+    int     triangles_drawn = 0;    // Triangles those draws submitted
+    int     chunks_deferred = 0;    // Dirty chunks left unmeshed behind the terrain
+    double  elapsed_ms      = 0.0;  // Time spent scanning and building this frame
+} far_terrain_stats_t;
+
+//----------------------------------------------------------------------------//
+//                            CLASS: Far_Terrain                              //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * 2.5D stand in for whole sectors far from the camera.
+ *
+ * Each sector keeps a FAR_TERRAIN_CELLS^2 grid of top surface heights and
+ * colours, read from its chunk columns as they change (LOD_8 mip cells find
+ * the top block, then one layer of voxels is averaged). Beyond the far
+ * terrain distance a sector is drawn as a single grid mesh through
+ * terrain.vert instead of its chunks, so those chunks need neither a mesh
+ * nor, once their column is in the heightfield (Has_Column), to be loaded
+ * at all.
+ *
+ * A column whose top lies in a chunk that is no longer loaded keeps its old
+ * cells, which lets unloading and streaming leave the heightfield intact.
+ * ============================================================================ */
+class Far_Terrain {
+public:
+    void    Mark_Dirty  (const sector_loc_t& sector, const chunk_loc_t& chunk);
+    void    Clear       ();
+
+    void    Update      (World& world, bool upload, float budget_ms);
+    int     Select      (const glm::vec3& camera, float distance);
+    int     Draw        (const Coil::Shader& shader, GLuint vertex_offset);
+    bool    Is_Drawn    (const sector_loc_t& sector) const;
+    bool    Has_Column  (const sector_loc_t& sector, const chunk_loc_t& chunk) const;
+
+    int     Save        (const std::filesystem::path& world_dir);
+    int     Load        (const std::filesystem::path& world_dir);
+
+    void    Set_Deferred(int chunks);
+    const far_terrain_stats_t&          Get_Stats       () const;
+    const std::vector<far_column_t>&    Get_Held_Columns() const;
+
+    static float    Sector_Distance (const sector_loc_t& sector, const glm::vec3& camera);
+    static bool     Scan_Column     (
+        World&                  world,
+        const sector_loc_t&     sector,
+        const glm::ivec2&       column,
+        far_cells_t&            cells,
+        bool*                   loaded = nullptr
+    );
+    static int      Build_Grid      (
+        const far_cells_t&      cells,
+        std::vector<GLfloat>&   vertices,
+        std::vector<GLuint>&    indices
+    );
+    static bool     Save_File       (const std::filesystem::path& file, const far_sector_t& entry);
+    static bool     Load_File       (const std::filesystem::path& file, far_sector_t& entry);
+
+private:
+    far_sector_t&   Get_Sector  (const sector_loc_t& sector);
+
+    std::unordered_map<uint32_t, far_sector_t>  sectors;
+    std::vector<GLfloat>                        vertex_scratch;
+    std::vector<GLuint>                         index_scratch;
+    std::vector<far_column_t>                   held_columns;   // Scanned by the last Update and now held
+    far_terrain_stats_t                         stats;
+};
+
+#endif // !FAR_TERRAIN_H
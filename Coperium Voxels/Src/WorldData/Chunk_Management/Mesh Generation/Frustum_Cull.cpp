@@ -0,0 +1,74 @@
+#include "Frustum_Cull.h"
+
+/* ============================================================================
+ * --------------------------- Extract_Frustum
+ * Builds the world space frustum planes from a view-projection matrix
+ * (Gribb / Hartmann). A point is in clip space when -w <= x, y, z <= w, and
+ * each of those six inequalities is one plane: row 3 plus or minus rows
+ * 0, 1 and 2 of the matrix.
+ *
+ * ------ Parameters ------
+ * view_projection : projection * view, OpenGL clip space (-1 .. 1 depth)
+ *
+ * ------ Returns ------
+ * The normalised planes
+ * ============================================================================ */
+frustum_t Extract_Frustum(const glm::mat4& view_projection) {
+    // GLM is column major, so row i is the i-th element of every column
+    auto row = [&](int i) {
+        return glm::vec4(view_projection[0][i], view_projection[1][i], view_projection[2][i], view_projection[3][i]);
+    };
+
+    frustum_t frustum;
+    frustum.planes[0] = row(3) + row(0);    // Left
+    frustum.planes[1] = row(3) - row(0);    // Right
+    frustum.planes[2] = row(3) + row(1);    // Bottom
+    frustum.planes[3] = row(3) - row(1);    // Top
+    frustum.planes[4] = row(3) + row(2);    // Near
+    frustum.planes[5] = row(3) - row(2);    // Far
+
+    for (glm::vec4& plane : frustum.planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+    frustum.valid = true;
+    return frustum;
+}
+
+/* ============================================================================
+ * --------------------------- Test_Frustum_Box
+ * Classifies an axis aligned box against the frustum. For each plane only
+ * the corner furthest along its normal (the p-vertex) has to be checked to
+ * reject the box, and the opposite corner (the n-vertex) to accept it. A
+ * box near a frustum corner may be reported as INTERSECTS when it is in
+ * fact outside; it is never reported OUTSIDE when any of it is visible.
+ *
+ * ------ Parameters ------
+ * frustum : The view frustum
+ * box_min : Minimum corner of the box
+ * box_max : Maximum corner of the box
+ * ============================================================================ */
+frustum_test_t Test_Frustum_Box(
+    const frustum_t&    frustum,
+    const glm::vec3&    box_min,
+    const glm::vec3&    box_max
+) {
+    frustum_test_t result = frustum_test_t::INSIDE;
+
+    for (const glm::vec4& plane : frustum.planes) {
+        const glm::vec3 normal(plane);
+        const glm::vec3 p_vertex(
+            normal.x >= 0.0f ? box_max.x : box_min.x,
+            normal.y >= 0.0f ? box_max.y : box_min.y,
+            normal.z >= 0.0f ? box_max.z : box_min.z
+        );
+        if (glm::dot(normal, p_vertex) + plane.w < 0.0f) return frustum_test_t::OUTSIDE;
+
+        const glm::vec3 n_vertex(
+            normal.x >= 0.0f ? box_min.x : box_max.x,
+            normal.y >= 0.0f ? box_min.y : box_max.y,
+            normal.z >= 0.0f ? box_min.z : box_max.z
+        );
+        if (glm::dot(normal, n_vertex) + plane.w < 0.0f) result = frustum_test_t::INTERSECTS;
+    }
+    return result;
+}
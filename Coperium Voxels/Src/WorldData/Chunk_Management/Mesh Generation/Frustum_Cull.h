@@ -0,0 +1,61 @@
+#pragma once
+#ifndef FRUSTUM_CULL_H
+#define FRUSTUM_CULL_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <GLM/glm.hpp>
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int NUM_FRUSTUM_PLANES = 6;   // Left, right, bottom, top, near, far
+
+//----------------------------------------------------------------------------//
+//                            ENUM: frustum_test_t                            //
+//----------------------------------------------------------------------------//
+enum class frustum_test_t {
+    OUTSIDE,        // Entirely outside one plane, nothing in it can be seen
+    INTERSECTS,     // Crosses at least one plane, its parts need testing
+    INSIDE          // Inside every plane, its parts need no testing
+};
+
+//----------------------------------------------------------------------------//
+//                             STRUCT: frustum_t                              //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * The six planes of a view frustum in world space, as (normal, distance)
+ * with the normals pointing inwards and normalised, so a point p is inside
+ * a plane when dot(normal, p) + distance >= 0.
+ * ============================================================================ */
+typedef struct frustum_t {
+    glm::vec4   planes[NUM_FRUSTUM_PLANES];
+    bool        valid = false;      // Set once built from a view-projection
+} frustum_t;
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: cull_stats_t                            //
+//----------------------------------------------------------------------------//
+typedef struct cull_stats_t {
+    int sectors_tested  = 0;    // Sectors tested against the frustum
+    int sectors_culled  = 0;    // Skipped whole, with all their chunks
+    int sectors_inside  = 0;    // Drawn whole without testing their chunks
+    int chunks_tested   = 0;    // Chunks tested on their own
+    int chunks_culled   = 0;    // Of those, found outside
+    int sections_culled = 0;    // Sections of partly visible chunks found outside
+    int chunks_occluded = 0;    // Chunks in the frustum hidden by occlusion_cull
+    int chunks_drawn    = 0;    // Chunks with at least one section drawn
+} cull_stats_t;
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+frustum_t       Extract_Frustum (const glm::mat4& view_projection);
+frustum_test_t  Test_Frustum_Box(
+    const frustum_t&    frustum,
+    const glm::vec3&    box_min,
+    const glm::vec3&    box_max
+);
+
+#endif // !FRUSTUM_CULL_H
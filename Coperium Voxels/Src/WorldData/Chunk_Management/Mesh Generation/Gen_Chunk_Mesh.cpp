@@ -1,6 +1,9 @@
 #include "Chunk_Mesh.h"
 #include "Calc_LOD.h"
+#include "Mesh_Scratch.h"
+#include "Mesh_Cache.h"
 #include "../WorldManager.h"
+#include <algorithm>
 #include <chrono>
 
 // Global state
@@ -51,7 +54,20 @@ bool Should_Update(int dt_ms, int update_interval_ms, bool& first_call, int& tim
 
 /* ============================================================================
  * --------------------------- Update_Chunk_LODs
- * Sets the LOD level for each chunk based on the camera position and settings.
+ * Sets the LOD level of the chunks whose distance ring could have changed
+ * since they were last checked, based on the camera position and settings.
+ *
+ * The first call (or the first after LOD is turned back on) checks every
+ * loaded chunk; after that lod_rings only hands back the chunks the camera
+ * has travelled far enough to move out of their band, margins included, so
+ * the cost follows camera movement rather than the number of loaded chunks.
+ * Chunks loaded later join in Schedule_Updated_Chunks.
+ *
+ * The thresholds are `lod_set`, or with `screen_error_lod` the ones that
+ * keep LOD cells under `lod_pixel_error` pixels for the current view.
+ * Whenever they change (a resize, an FOV change, edited settings) every
+ * chunk is checked again, since the ring entries were made with the old
+ * ones.
  *
  * Will reset chunks to NORMAL if LOD is disabled.
  *
@@ -62,45 +78,330 @@ void WorldManager::Update_Chunk_LODs(
     const glm::vec3& player_position
 ) {
     sectors_t* sectors = world.Get_All_Sectrs();
-    for (auto [sector_pos, sector_ptr] : *sectors) {
-        chunks_t* chunks = sector_ptr->Get_All_Chunks();
-        for (auto [chunk_pos, chunk_ptr] : *chunks) {
-            chunk_data_t& data = chunk_ptr->Get_Chunk_Data();
-            if (!settings.use_lod) {
+
+    if (!settings.use_lod) {
+        lod_rings.Clear();
+        lods_tracked = false;
+
+        for (auto [sector_pos, sector_ptr] : *sectors) {
+            chunks_t* chunks = sector_ptr->Get_All_Chunks();
+            for (auto [chunk_pos, chunk_ptr] : *chunks) {
+                chunk_data_t& data = chunk_ptr->Get_Chunk_Data();
                 if (data.l_o_d != lod_Level_t::NORMAL) {
                     data.l_o_d = lod_Level_t::NORMAL;
-                    data.updated = true;
-                }
-                continue;
-            }else {
-
-                lod_Level_t new_lod = Compute_LOD(sector_pos, chunk_pos, player_position, settings.lod_set);
-                if (new_lod != data.l_o_d) {
-                    data.l_o_d = new_lod;
-                    data.updated = true;
-                    Set_Neighbours_to_Update(
-                        glm::ivec3(sector_pos.X(),        0     , sector_pos.Z()), 
-                        glm::ivec3(chunk_pos. X(), chunk_pos.Y(), chunk_pos .Z())
-                    );
+                    world.Mark_Chunk_Dirty(sector_pos, chunk_pos);
                 }
             }
+        }
+        return;
+    }
+
+    const lod_dst_set_t lod_set = settings.screen_error_lod
+        ? Screen_Error_LOD_Set(settings.lod_set, view_fov, view_height, settings.lod_pixel_error)
+        : settings.lod_set;
+    if (!(lod_set == active_lod_set)) {
+        active_lod_set = lod_set;
+        lod_rings.Clear();
+        lods_tracked = false;
+    }
 
+    lod_rings.Move_Camera(player_position);
+
+    if (!lods_tracked) {
+        for (auto [sector_pos, sector_ptr] : *sectors) {
+            chunks_t* chunks = sector_ptr->Get_All_Chunks();
+            for (auto [chunk_pos, chunk_ptr] : *chunks) {
+                Assign_Chunk_LOD(sector_pos, chunk_pos, *chunk_ptr, player_position);
+            }
         }
+        lods_tracked = true;
+        return;
+    }
+
+    lod_ring_entry_t entry;
+    while (lod_rings.Pop_Due(entry)) {
+        std::shared_ptr<Sector>* sector_ptr = sectors->Find(entry.sector);
+        if (!sector_ptr || !*sector_ptr) continue;
+
+        std::shared_ptr<Chunk>* chunk_ptr = (*sector_ptr)->Get_All_Chunks()->Find(entry.chunk);
+        if (!chunk_ptr || !*chunk_ptr) continue;
+
+        // A reloaded chunk has a newer entry of its own
+        if ((*chunk_ptr)->Get_Chunk_Data().lod_due != entry.due) continue;
+
+        Assign_Chunk_LOD(entry.sector, entry.chunk, **chunk_ptr, player_position);
     }
 }
 
+/* ============================================================================
+ * --------------------------- Assign_Chunk_LOD
+ * Computes a chunk's LOD with hysteresis, queues its next check in
+ * lod_rings and, if the LOD changed, queues it and its neighbours for
+ * remeshing. A chunk with no LOD yet was just added and is already queued
+ * by whatever added it.
+ *
+ * ------ Parameters ------
+ * sector_loc      : Sector holding the chunk.
+ * chunk_loc       : The chunk within the sector.
+ * chunk           : The chunk itself.
+ * player_position : The current camera position.
+ * ============================================================================ */
+void WorldManager::Assign_Chunk_LOD(
+    const sector_loc_t& sector_loc,
+    const chunk_loc_t&  chunk_loc,
+    Chunk&              chunk,
+    const glm::vec3&    player_position
+) {
+    chunk_data_t& data  = chunk.Get_Chunk_Data();
+    float         slack = 0.0f;
+
+    const lod_Level_t new_lod = Compute_LOD(
+        sector_loc, chunk_loc, player_position, active_lod_set, data.l_o_d, &slack
+    );
+    data.lod_due = lod_rings.Push(sector_loc, chunk_loc, slack);
+
+    if (new_lod == data.l_o_d) return;
+
+    const bool first = data.l_o_d == lod_Level_t::UNSET;
+    data.l_o_d = new_lod;
+    if (first) return;
+
+    Set_Neighbours_to_Update(
+        glm::ivec3(sector_loc.X(),        0     , sector_loc.Z()),
+        glm::ivec3(chunk_loc. X(), chunk_loc.Y(), chunk_loc .Z())
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Resolve_LOD
+ * Turns an unset LOD into NORMAL so it can be meshed.
+ * ============================================================================ */
+static void Resolve_LOD(chunk_data_t& data) {
+    if (data.l_o_d == lod_Level_t::UNSET || static_cast<int>(data.l_o_d) <= 0) {
+        data.l_o_d = lod_Level_t::NORMAL;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Generate_Chunk_Mesh_At_LOD
+ * Builds a chunk's mesh at the LOD stored in its chunk data, resolving an
+ * unset LOD to NORMAL first. The chunk's key goes into the context for
+ * the mesh arena. A context with `max_sections` below NUM_SECTIONS carries
+ * on with a build already under way, and each call builds that many more
+ * of its sections; the new meshes are drawn once the last one is built.
+ * A build started at another LOD or in another format, or one a whole
+ * chunk build (the default context) runs into, is started over.
+ *
+ * ------ Parameters ------
+ * world         : The game world containing all sectors and chunks.
+ * sector_pair   : The sector holding the chunk.
+ * chunk_pair    : The chunk to mesh.
+ * generic_chunk : A shared/default chunk used during mesh generation.
+ * ctx           : Mesh format and shared resources owned by the renderer.
+ *
+ * ------ Returns ------
+ * The number of faces generated.
+ * ============================================================================ */
+int Generate_Chunk_Mesh_At_LOD(
+    World&                  world,
+    sector_pair_t           sector_pair,
+    chunk_pair_t            chunk_pair,
+    const Chunk&            generic_chunk,
+    const mesh_gen_ctx_t&   ctx
+) {
+    Chunk&        chunk = *chunk_pair.second;
+    chunk_data_t& data  = chunk.Get_Chunk_Data();
+    Resolve_LOD(data);
+
+    mesh_gen_ctx_t chunk_ctx = ctx;
+    chunk_ctx.arena_chunk    = Mesh_Arena::Chunk_Key(sector_pair.first, chunk_pair.first);
+
+    if (chunk.Is_Building() && (
+        ctx.max_sections >= NUM_SECTIONS ||
+        data.mesh_lod != data.l_o_d      ||
+        chunk.Get_Build_Format() != ctx.format)) {
+        Restart_Chunk_Build(chunk, chunk_ctx);
+    }
+    data.mesh_lod = data.l_o_d;
+    data.mesh_key = 0;      // Known only to Build_Chunk_Mesh
+
+    if (data.l_o_d == lod_Level_t::NORMAL) {
+        return Generate_Chunk_Mesh(world, sector_pair, chunk_pair, generic_chunk, chunk_ctx);
+    }
+    return Generate_Chunk_Mesh(
+        world, sector_pair, chunk_pair, generic_chunk,
+        static_cast<int>(data.l_o_d), chunk_ctx
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Upload_Cached_Mesh
+ * Uploads every section of a cached mesh through the normal upload path,
+ * so the chunk ends up exactly as if it had been meshed.
+ *
+ * ------ Returns ------
+ * The number of faces uploaded.
+ * ============================================================================ */
+static int Upload_Cached_Mesh(Chunk& chunk, const mesh_cache_t& cache, const mesh_gen_ctx_t& ctx) {
+    mesh_scratch_t& scratch = Get_Mesh_Scratch();
+    int total_faces = 0;
+
+    for (int section = 0; section < NUM_SECTIONS; section++) {
+        const mesh_cache_section_t& cached = cache.sections[section];
+
+        scratch.Reset();
+        scratch.vertex_mesh    = cached.vertex_mesh;
+        scratch.face_mesh      = cached.face_mesh;
+        scratch.face_slots     = cached.face_slots;
+        scratch.has_face_slots = cached.has_face_slots;
+
+        Upload_Chunk_Mesh(chunk, section, scratch, cached.num_faces, ctx);
+        total_faces += cached.num_faces;
+    }
+    Finish_Chunk_Build(chunk, ctx);
+    return total_faces;
+}
+
+/* ============================================================================
+ * --------------------------- Chunk_Face_Count
+ * Faces in all of a chunk's meshes.
+ * ============================================================================ */
+static int Chunk_Face_Count(const Chunk& chunk) {
+    int faces = 0;
+    for (int section = 0; section < NUM_SECTIONS; ++section) {
+        faces += chunk.Get_Section_Faces(section);
+    }
+    return faces;
+}
+
+/* ============================================================================
+ * --------------------------- Build_Chunk_Mesh
+ * Meshes a chunk at its LOD. A chunk flagged try_mesh_cache (just loaded
+ * from disk or imported at start up) first looks for a cached mesh whose
+ * key still matches its voxels and neighbours and uploads that instead.
+ * On a miss the whole chunk is built and the result saved for next time.
+ * The flag is cleared either way, so later edits always remesh.
+ *
+ * With `lod_cache_budget_bytes` set the same key also drives the in memory
+ * LOD cache: a chunk whose inputs have not changed keeps its mesh, a mesh
+ * parked for its LOD with a matching key is swapped in, and when only the
+ * LOD or a neighbour changed the outgoing mesh is parked before the chunk
+ * is rebuilt in full. Sections in the mesh arena have no mesh of their own
+ * to park, so the LOD cache is skipped while the arena is used.
+ *
+ * Both caches deal in whole chunks, so their chunks are built in one call
+ * whatever the context's `max_sections`. A chunk whose build is already
+ * spread over calls carries on with it instead.
+ *
+ * ------ Parameters ------
+ * sector_pair : The sector holding the chunk.
+ * chunk_pair  : The chunk to mesh.
+ * ctx         : Mesh format and shared resources owned by the renderer.
+ * from_cache  : Optional, set to whether a cached mesh was used.
+ *
+ * ------ Returns ------
+ * The number of faces in the chunk's new mesh.
+ * ============================================================================ */
+int WorldManager::Build_Chunk_Mesh(
+    const sector_pair_t&    sector_pair,
+    const chunk_pair_t&     chunk_pair,
+    const mesh_gen_ctx_t&   ctx,
+    bool*                   from_cache
+) {
+    if (from_cache) *from_cache = false;
+
+    Chunk&        chunk = *chunk_pair.second;
+    chunk_data_t& data  = chunk.Get_Chunk_Data();
+
+    const bool use_disk_cache = settings.use_mesh_cache && settings.allow_chunk_store && data.try_mesh_cache;
+    const bool use_lod_cache  = settings.lod_cache_budget_bytes > 0 && !ctx.arena;
+
+    if ((chunk.Is_Building() && ctx.max_sections < NUM_SECTIONS) || (!use_disk_cache && !use_lod_cache)) {
+        return Generate_Chunk_Mesh_At_LOD(world, sector_pair, chunk_pair, settings.generic_chunk, ctx);
+    }
+    data.try_mesh_cache = false;
+    Resolve_LOD(data);
+
+    mesh_gen_ctx_t whole_ctx = ctx;
+    whole_ctx.max_sections   = NUM_SECTIONS;
+    whole_ctx.arena_chunk    = Mesh_Arena::Chunk_Key(sector_pair.first, chunk_pair.first);
+    if (chunk.Is_Building()) Restart_Chunk_Build(chunk, whole_ctx);
+
+    uint64_t voxels = 0;
+    const uint64_t key = Mesh_Cache_Key(
+        get_chunk_neighbours(world, chunk_pair, sector_pair, settings.generic_chunk),
+        chunk, ctx.format, &voxels
+    );
+    const uint64_t uploaded_key = ctx.depth_sort ? ~key : key;    // Uploads also differ by face order
+
+    if (use_lod_cache) {
+        if (data.mesh_key    == uploaded_key &&
+            data.mesh_lod    == data.l_o_d   &&
+            data.mesh_format == ctx.format) {
+            chunk.Clear_Dirty_Sections();
+            if (from_cache) *from_cache = true;
+            return Chunk_Face_Count(chunk);
+        }
+
+        if (lod_mesh_cache.Swap_In(sector_pair.first, chunk_pair.first, chunk, uploaded_key, ctx.format)) {
+            if (from_cache) *from_cache = true;
+            return Chunk_Face_Count(chunk);
+        }
+
+        if (data.mesh_key != 0 && data.mesh_voxels == voxels &&
+            (data.mesh_lod != data.l_o_d || chunk.Get_Dirty_Sections() == ALL_SECTIONS)) {
+            lod_mesh_cache.Park(sector_pair.first, chunk_pair.first, chunk);
+            chunk.Mark_Sections_Dirty(ALL_SECTIONS);
+        }
+    }
+
+    int faces = 0;
+    mesh_cache_t cache;
+    if (!use_disk_cache) {
+        faces = Generate_Chunk_Mesh_At_LOD(world, sector_pair, chunk_pair, settings.generic_chunk, whole_ctx);
+    }
+    else if (Read_Mesh_Cache(sector_pair.first, chunk_pair.first, cache) &&
+        cache.key    == key        &&
+        cache.l_o_d  == data.l_o_d &&
+        cache.format == ctx.format) {
+        chunk.Clear_Dirty_Sections();
+        if (from_cache) *from_cache = true;
+        faces = Upload_Cached_Mesh(chunk, cache, whole_ctx);
+    }
+    else {
+        cache        = mesh_cache_t();
+        cache.key    = key;
+        cache.l_o_d  = data.l_o_d;
+        cache.format = ctx.format;
+
+        mesh_gen_ctx_t capture_ctx = whole_ctx;
+        capture_ctx.capture = &cache;
+
+        chunk.Mark_Sections_Dirty(ALL_SECTIONS);    // The cache holds whole chunks
+        faces = Generate_Chunk_Mesh_At_LOD(world, sector_pair, chunk_pair, settings.generic_chunk, capture_ctx);
+        Store_Mesh_Cache(sector_pair.first, chunk_pair.first, cache);
+    }
+
+    data.mesh_lod    = data.l_o_d;
+    data.mesh_key    = ctx.arena ? 0 : uploaded_key;    // Arena sections are never kept or parked
+    data.mesh_voxels = voxels;
+    return faces;
+}
+
 /* ============================================================================
  * --------------------------- Regenerate_Update_Meshes
  * Re-generates the mesh for all chunks marked as updated, based on their LOD.
+ * Ignores the frame budget; used when every chunk must change together.
  *
  * ------ Parameters ------
  * world         : The game world containing all sectors and chunks.
  * generic_chunk : A shared/default chunk used during mesh generation.
+ * ctx           : Mesh format and shared resources owned by the renderer.
  *
  * ------ Returns ------
  * true if any chunks were regenerated; false otherwise.
  * ============================================================================ */
-bool Regenerate_Update_Meshes(World& world, Chunk& generic_chunk) {
+bool Regenerate_Update_Meshes(World& world, Chunk& generic_chunk, const mesh_gen_ctx_t& ctx) {
     bool changed = false;
     sectors_t* sectors = world.Get_All_Sectrs();
 
@@ -110,48 +411,412 @@ bool Regenerate_Update_Meshes(World& world, Chunk& generic_chunk) {
             chunk_data_t& data = chunk_ptr->Get_Chunk_Data();
             if (!data.updated) continue;
 
-            if (data.l_o_d == lod_Level_t::UNSET || static_cast<int>(data.l_o_d) <= 0) {
-                data.l_o_d = lod_Level_t::NORMAL;
+            Generate_Chunk_Mesh_At_LOD(
+                world,
+                { sector_pos, sector_ptr },
+                { chunk_pos, chunk_ptr },
+                generic_chunk,
+                ctx
+            );
+
+            data.updated = false;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+/* ============================================================================
+ * --------------------------- Behind_Far_Terrain
+ * Whether a sector lies far enough behind the far terrain distance (plus
+ * FAR_TERRAIN_MARGIN) that its chunks are neither meshed nor kept loaded.
+ * ============================================================================ */
+bool WorldManager::Behind_Far_Terrain(
+    const sector_loc_t& sector,
+    const glm::vec3&    player_position
+) const {
+    return settings.use_far_terrain &&
+        Far_Terrain::Sector_Distance(sector, player_position) >
+        settings.far_terrain_distance + FAR_TERRAIN_MARGIN;
+}
+
+/* ============================================================================
+ * --------------------------- Schedule_Updated_Chunks
+ * Moves the world's dirty chunks into the remesh queue, ordered by distance
+ * and view direction from the camera. The cost is proportional to the number
+ * of chunks that changed, not the size of the world.
+ * Newly loaded chunks are given their LOD and join lod_rings on the way,
+ * every dirty chunk flags its HLOD group and far terrain column, and joins
+ * the render queue if it is not in it yet.
+ * Chunks in sectors beyond the far terrain distance (plus
+ * FAR_TERRAIN_MARGIN) are held back unmeshed in far_deferred and rejoin
+ * the queue once the camera comes near enough.
+ *
+ * ------ Parameters ------
+ * player_position : The camera position.
+ * player_front    : The camera view direction (zero to ignore direction).
+ * ============================================================================ */
+void WorldManager::Schedule_Updated_Chunks(
+    const glm::vec3& player_position,
+    const glm::vec3& player_front
+) {
+    dirty_scratch.clear();
+    world.Get_Dirty_Chunks()->Drain(dirty_scratch);
+
+    std::erase_if(far_deferred, [&](const dirty_chunk_t& deferred) {
+        if (Behind_Far_Terrain(deferred.sector, player_position)) return false;
+        dirty_scratch.push_back(deferred);
+        return true;
+    });
+
+    // Chunks loaded since the last LOD update get a LOD before they are meshed
+    if (settings.use_lod && lods_tracked) {
+        lod_rings.Move_Camera(player_position);
+
+        for (const dirty_chunk_t& dirty : dirty_scratch) {
+            std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(dirty.sector);
+            if (!sector_ptr || !*sector_ptr) continue;
+
+            std::shared_ptr<Chunk>* chunk_ptr = (*sector_ptr)->Get_All_Chunks()->Find(dirty.chunk);
+            if (!chunk_ptr || !*chunk_ptr) continue;
+
+            if ((*chunk_ptr)->Get_Chunk_Data().lod_due < 0.0) {
+                Assign_Chunk_LOD(dirty.sector, dirty.chunk, **chunk_ptr, player_position);
             }
+        }
+    }
 
-            if (data.l_o_d == lod_Level_t::NORMAL) {
-                Generate_Chunk_Mesh(
-                    world,
-                    { sector_pos, sector_ptr },
-                    { chunk_pos, chunk_ptr },
-                    generic_chunk
-                );
+    for (const dirty_chunk_t& dirty : dirty_scratch) {
+        if (hlods_tracked  ) hlod_groups.Mark_Dirty(dirty.sector, dirty.chunk);
+        if (terrain_tracked) far_terrain.Mark_Dirty(dirty.sector, dirty.chunk);
+        if (queue_tracked) {
+            std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(dirty.sector);
+            std::shared_ptr<Chunk>*  chunk_ptr  = (sector_ptr && *sector_ptr)
+                ? (*sector_ptr)->Get_All_Chunks()->Find(dirty.chunk) : nullptr;
+            if (chunk_ptr && *chunk_ptr) render_queue.Insert(dirty.sector, dirty.chunk, *chunk_ptr);
+        }
+
+        if (Behind_Far_Terrain(dirty.sector, player_position)) {
+            far_deferred.push_back(dirty);
+            continue;
+        }
+        remesh_scheduler.Push(
+            dirty.sector, dirty.chunk,
+            Remesh_Scheduler::Compute_Priority(
+                dirty.sector, dirty.chunk, player_position, player_front
+            )
+        );
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Apply_Mesh_Patches
+ * Writes queued recolours straight into the mesh of their section, or its
+ * place in the mesh arena, with glBufferSubData. A section falls back to a normal rebuild when it has no
+ * slot map (LOD meshes), is in the wrong format, is already waiting for a
+ * rebuild, or collected more than FACE_PATCH_MAX_PER_SECTION edits, since a
+ * single upload is then cheaper than many small ones. So does a section
+ * whose chunk build has already built its back mesh: that mesh predates
+ * the recolour and replaces the patched one when the build swaps in.
+ * Sections are stored grouped by direction, so each patched face is
+ * written to the slot its face_order gives it. A patched chunk still marks its HLOD group and far
+ * terrain columns dirty, as both are built from its voxels.
+ *
+ * ------ Returns ------
+ * The number of recolours written in place.
+ * ============================================================================ */
+int WorldManager::Apply_Mesh_Patches() {
+    if (pending_recolours.empty()) return 0;
+
+    auto section_key = [](const voxel_recolour_t& r) {
+        return ((static_cast<uint64_t>(r.sector.location) << 16 | r.chunk.location) << 2)
+            | static_cast<uint64_t>(r.local.y / SECTION_SIZE_Y);
+    };
+    std::sort(
+        pending_recolours.begin(), pending_recolours.end(),
+        [&](const voxel_recolour_t& a, const voxel_recolour_t& b) {
+            return section_key(a) < section_key(b);
+        }
+    );
+
+    int patched = 0;
+    size_t first = 0;
+    while (first < pending_recolours.size()) {
+        size_t last = first;
+        while (last < pending_recolours.size() &&
+               section_key(pending_recolours[last]) == section_key(pending_recolours[first])) ++last;
+
+        const voxel_recolour_t& group = pending_recolours[first];
+        const int section = group.local.y / SECTION_SIZE_Y;
+
+        std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(group.sector);
+        std::shared_ptr<Chunk>*  chunk_ptr  = (sector_ptr && *sector_ptr)
+            ? (*sector_ptr)->Get_All_Chunks()->Find(group.chunk)
+            : nullptr;
+
+        if (chunk_ptr && *chunk_ptr) {
+            Chunk& chunk = **chunk_ptr;
+
+            const bool rebuild =
+                !chunk.Is_Section_Patchable(section)                            ||
+                chunk.Get_Chunk_Data().mesh_format != settings.mesh_format      ||
+                (chunk.Get_Dirty_Sections() & (1 << section))                   ||
+                chunk.Is_Back_Ready(section)                                    ||
+                static_cast<int>(last - first) > FACE_PATCH_MAX_PER_SECTION;
+
+            if (rebuild) {
+                world.Mark_Chunk_Dirty(group.sector, group.chunk, 1 << section);
             }
             else {
-                Generate_Chunk_Mesh(
-                    world,
-                    { sector_pos, sector_ptr },
-                    { chunk_pos, chunk_ptr },
-                    generic_chunk,
-                    static_cast<int>(data.l_o_d)
+                const uint64_t arena_key = Mesh_Arena::Section_Key(
+                    Mesh_Arena::Chunk_Key(group.sector, group.chunk), section
                 );
+                for (size_t i = first; i < last; ++i) {
+                    const glm::ivec3& local = pending_recolours[i].local;
+                    if (!Build_Recolour_Patch(
+                        chunk.Get_Face_Slots(section), local,
+                        chunk.Get_Voxel(local)->GetColour(),
+                        settings.mesh_format, patch_scratch
+                    )) continue;
+
+                    const std::vector<uint16_t>& order = chunk.Get_Face_Order(section);
+                    const GLsizeiptr face_bytes = static_cast<GLsizeiptr>(Mesh_Bytes_Per_Face(settings.mesh_format));
+                    const char*      data       = static_cast<const char*>(patch_scratch.Get_Data());
+
+                    for (int f = 0; f < patch_scratch.num_faces; ++f) {
+                        const uint16_t face = order[patch_scratch.first_face + f];
+                        if (mesh_arena.Write_Faces(arena_key, face, data + f * face_bytes, 1)) continue;
+
+                        chunk.Get_Mesh(section).Update_Vertex_Data(face * face_bytes, face_bytes, data + f * face_bytes);
+                    }
+                    ++patched;
+                }
+                chunk.Get_Chunk_Data().mesh_key = 0;    // No longer what the key describes
+
+                if (hlods_tracked  ) hlod_groups.Mark_Dirty(group.sector, group.chunk);
+                if (terrain_tracked) far_terrain.Mark_Dirty(group.sector, group.chunk);
             }
+        }
+        first = last;
+    }
 
-            data.updated = false;
-            changed = true;
+    pending_recolours.clear();
+    return patched;
+}
+
+/* ============================================================================
+ * --------------------------- Mesh_Gen_Context
+ * The mesh format and shared resources chunks are built with. With
+ * `use_mesh_arena` (and GL 4.2) their sections go into the mesh arena.
+ * ============================================================================ */
+mesh_gen_ctx_t WorldManager::Mesh_Gen_Context() {
+    mesh_gen_ctx_t ctx{ &quad_index_buffer, chunk_offsets.Get_Buffer(), settings.mesh_format, settings.two_pass_mesh, settings.depth_sort_faces };
+    if (settings.use_mesh_arena && Mesh_Arena::Is_Supported()) ctx.arena = &mesh_arena;
+    return ctx;
+}
+
+/* ============================================================================
+ * --------------------------- Drain_Remesh_Queue
+ * Remeshes queued chunks, most urgent first, until the queue is empty or
+ * `remesh_budget_ms` has been spent. Each step builds one section into the
+ * chunk's back meshes, and a chunk with sections left goes back in the
+ * queue at the same priority, so a build can be spread over frames while
+ * the chunk keeps drawing its old meshes until all of them are ready. At
+ * least one step is taken per call so the queue always makes progress.
+ * Chunks that were unloaded or already rebuilt since being queued are
+ * skipped. A chunk edited while it was being built stays flagged for
+ * another build.
+ *
+ * With `remesh_budget_bytes` set, full detail chunks are sized by the face
+ * counting pass before their build starts, and a chunk that would push the
+ * frame's uploads over the budget is put back for the next frame.
+ * ============================================================================ */
+void WorldManager::Drain_Remesh_Queue() {
+    mesh_gen_ctx_t ctx = Mesh_Gen_Context();
+    ctx.max_sections   = 1;
+
+    auto start   = std::chrono::steady_clock::now();
+    remesh_stats = remesh_stats_t();
+    int  steps   = 0;
+
+    while (!remesh_scheduler.Empty()) {
+        remesh_entry_t entry = remesh_scheduler.Pop();
+
+        std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(entry.sector);
+        if (!sector_ptr || !*sector_ptr) continue;
+
+        std::shared_ptr<Chunk>* chunk_ptr = (*sector_ptr)->Get_All_Chunks()->Find(entry.chunk);
+        if (!chunk_ptr || !*chunk_ptr) continue;
+
+        Chunk&        chunk = **chunk_ptr;
+        chunk_data_t& data  = chunk.Get_Chunk_Data();
+        if (!data.updated) continue;
+
+        if (settings.remesh_budget_bytes > 0 && steps > 0 && !chunk.Is_Building() &&
+            (data.l_o_d == lod_Level_t::NORMAL || data.l_o_d == lod_Level_t::UNSET)) {
+            const int    sections = (*chunk_ptr)->Get_Dirty_Sections();
+            const size_t estimate = Mesh_Bytes_Per_Face(settings.mesh_format) * Count_Chunk_Faces(
+                world,
+                { entry.sector, *sector_ptr },
+                { entry.chunk , *chunk_ptr  },
+                settings.generic_chunk,
+                sections ? sections : ALL_SECTIONS
+            );
+
+            if (remesh_stats.bytes_built + estimate > static_cast<size_t>(settings.remesh_budget_bytes)) {
+                remesh_scheduler.Push(entry.sector, entry.chunk, entry.priority);
+                break;
+            }
         }
+
+        const int faces = Build_Chunk_Mesh(
+            { entry.sector, *sector_ptr },
+            { entry.chunk , *chunk_ptr  },
+            ctx
+        );
+        ++steps;
+        remesh_stats.bytes_built += Mesh_Bytes_Per_Face(settings.mesh_format) * faces;
+
+        if (chunk.Is_Building()) {
+            remesh_scheduler.Push(entry.sector, entry.chunk, entry.priority);
+        }
+        else {
+            data.updated = chunk.Get_Dirty_Sections() != 0;
+            ++remesh_stats.chunks_meshed;
+        }
+
+        remesh_stats.elapsed_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+
+        if (settings.remesh_budget_ms > 0.0f &&
+            remesh_stats.elapsed_ms >= settings.remesh_budget_ms) break;
     }
 
-    return changed;
+    remesh_stats.chunks_pending = static_cast<int>(remesh_scheduler.Size());
+
+    if (settings.debug && remesh_stats.chunks_meshed > 0) {
+        std::cout << "Remeshed " << remesh_stats.chunks_meshed << " chunks in "
+                  << remesh_stats.elapsed_ms << " ms ("
+                  << remesh_stats.bytes_built << " bytes), "
+                  << remesh_stats.chunks_pending << " pending" << std::endl;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Update_HLOD_Groups
+ * Rebuilds the far field group meshes within `hlod_budget_ms`. The first
+ * call with `use_hlod` on flags the group of every loaded chunk; after that
+ * groups only hear about chunks that changed. Turning it off drops them.
+ *
+ * ------ Parameters ------
+ * ctx             : Mesh format and shared resources owned by the renderer.
+ * player_position : The current camera position.
+ * ============================================================================ */
+void WorldManager::Update_HLOD_Groups(
+    const mesh_gen_ctx_t&   ctx,
+    const glm::vec3&        player_position
+) {
+    if (!settings.use_hlod) {
+        if (hlods_tracked) hlod_groups.Clear();
+        hlods_tracked = false;
+        return;
+    }
+
+    if (!hlods_tracked) {
+        for (auto [sector_pos, sector_ptr] : *world.Get_All_Sectrs()) {
+            for (auto [chunk_pos, chunk_ptr] : *sector_ptr->Get_All_Chunks()) {
+                hlod_groups.Mark_Dirty(sector_pos, chunk_pos);
+            }
+        }
+        hlods_tracked = true;
+    }
+
+    hlod_groups.Rebuild(world, ctx, player_position, settings.hlod_distance, settings.hlod_budget_ms);
+
+    if (settings.debug && hlod_groups.Get_Stats().groups_built > 0) {
+        std::cout << "Rebuilt " << hlod_groups.Get_Stats().groups_built << " HLOD groups in "
+                  << hlod_groups.Get_Stats().elapsed_ms << " ms, "
+                  << hlod_groups.Get_Stats().groups_pending << " pending" << std::endl;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Update_Far_Terrain
+ * Scans changed columns and rebuilds the far terrain grids within
+ * `far_terrain_budget_ms`. The first call with `use_far_terrain` on reads
+ * the heightfields saved with the world (so far sectors show before any of
+ * their chunks load) and flags the column of every loaded chunk. Columns
+ * read this frame may free the chunks behind the terrain (Release_Far_Columns).
+ * Turning it off drops the heightfields; the chunks held back behind them
+ * rejoin the remesh queue on the next schedule.
+ * ============================================================================ */
+void WorldManager::Update_Far_Terrain(const glm::vec3& player_position) {
+    if (!settings.use_far_terrain) {
+        if (terrain_tracked) far_terrain.Clear();
+        terrain_tracked = false;
+        return;
+    }
+
+    if (!terrain_tracked) {
+        if (settings.allow_load_from_file) Read_Far_Terrain();
+        for (auto [sector_pos, sector_ptr] : *world.Get_All_Sectrs()) {
+            for (auto [chunk_pos, chunk_ptr] : *sector_ptr->Get_All_Chunks()) {
+                far_terrain.Mark_Dirty(sector_pos, chunk_pos);
+            }
+        }
+        terrain_tracked = true;
+    }
+
+    far_terrain.Update(world, true, settings.far_terrain_budget_ms);
+    Release_Far_Columns(player_position);
+    far_terrain.Set_Deferred(static_cast<int>(far_deferred.size()));
+
+    if (settings.debug && far_terrain.Get_Stats().meshes_built > 0) {
+        std::cout << "Rebuilt " << far_terrain.Get_Stats().meshes_built << " far terrain grids ("
+                  << far_terrain.Get_Stats().columns_scanned << " columns scanned) in "
+                  << far_terrain.Get_Stats().elapsed_ms << " ms, "
+                  << far_terrain.Get_Stats().chunks_deferred << " chunks deferred" << std::endl;
+    }
 }
 
 /* ============================================================================
  * --------------------------- Generate_All_Chunk_Meshes
  * Main entry point for generating all chunk meshes with optional LOD support.
  *
- * Updates chunk LODs once unless `dynamic_lod` is enabled. Chunks are still
- * checked for mesh regeneration even if the player hasn't moved. Update
- * frequency is limited by `update_interval_ms`.
+ * Updates chunk LODs once unless `dynamic_lod` is enabled. Every
+ * `update_interval_ms` the world's dirty chunks are queued by priority (and
+ * queued ones re-sorted if the camera moved); the queue is then drained each
+ * frame within `remesh_budget_ms`. Queued recolours are patched into the
+ * existing meshes first. A `mesh_format` or `use_mesh_arena` change
+ * rebuilds every chunk immediately and drops the meshes parked in the LOD
+ * cache and the mesh arena. Far field
+ * groups and far terrain grids are rebuilt last, from whatever the chunks
+ * hold by then.
  *
  * ------ Parameters ------
  * player_position: The player's current position in world space.
+ * player_front:    The player's view direction.
  * ============================================================================ */
-void WorldManager::Generate_All_Chunk_Meshes(glm::vec3 player_position) {
+void WorldManager::Generate_All_Chunk_Meshes(glm::vec3 player_position, glm::vec3 player_front) {
+    const mesh_gen_ctx_t ctx = Mesh_Gen_Context();
+
+    const int voxels_patched = Apply_Mesh_Patches();
+    lod_mesh_cache.Set_Budget(static_cast<size_t>(std::max(settings.lod_cache_budget_bytes, 0)));
+
+    // A format switch rebuilds everything at once so the renderer, which only
+    // draws chunks in the active format, is not left with holes. So does
+    // moving the chunks into or out of the arena.
+    if (settings.mesh_format != built_mesh_format || (ctx.arena != nullptr) != built_mesh_arena) {
+        world.Mark_All_Chunks_Dirty();
+        lod_mesh_cache.Clear();
+        mesh_arena.Clear();
+        built_mesh_format = settings.mesh_format;
+        built_mesh_arena  = ctx.arena != nullptr;
+        Regenerate_Update_Meshes(world, settings.generic_chunk, ctx);
+    }
+
     auto now = std::chrono::steady_clock::now();
     int dt_ms = (int)std::chrono::duration_cast<std::chrono::milliseconds>(
         now - last_update_time
@@ -165,23 +830,30 @@ void WorldManager::Generate_All_Chunk_Meshes(glm::vec3 player_position) {
         glm::round(player_position.z)
     );
 
-    if (!Should_Update(
+    if (Should_Update(
         dt_ms,
         settings.update_interval_ms,
         initial_update,
         time_acc_ms
-    )) return;
-
-    bool moved = Has_Moved(
-        last_chunk_mesh, curr_position,
-        settings.smart_update
-    );
+    )) {
+        bool moved = Has_Moved(
+            last_chunk_mesh, curr_position,
+            settings.smart_update
+        );
+
+        if (initial_update || !settings.smart_update || moved) {
+            Update_Chunk_LODs(player_position);
+            remesh_scheduler.Reprioritise(player_position, player_front);
+        }
 
-    if (initial_update || !settings.smart_update || moved) {
-        Update_Chunk_LODs(player_position);
+        Schedule_Updated_Chunks(player_position, player_front);
     }
 
-    Regenerate_Update_Meshes(world, settings.generic_chunk);
+    Drain_Remesh_Queue();
+    remesh_stats.voxels_patched = voxels_patched;
+
+    Update_HLOD_Groups(ctx, player_position);
+    Update_Far_Terrain(player_position);
 }
 
 /* ============================================================================
@@ -204,7 +876,10 @@ void Clear_Cache_Thrasher() {
 /* ============================================================================
  * --------------------------- Force Regenerate All Chunk Meshes Timed
  * Regenerates every chunk mesh ignoring `updated` flags, after clearing cache.
- * Prints CPU cycles taken to stdout.
+ * Prints CPU cycles taken to stdout. Chunks flagged try_mesh_cache upload a
+ * matching mesh from the on-disk cache instead, and with the LOD cache on a
+ * chunk whose inputs have not changed keeps its mesh; turn `use_mesh_cache`
+ * off and set `lod_cache_budget_bytes` to 0 to time the mesher alone.
  * ============================================================================ */
 void WorldManager::Force_Generate_Meshes(glm::vec3 player_position) {
     // 1) Evict cache
@@ -214,9 +889,18 @@ void WorldManager::Force_Generate_Meshes(glm::vec3 player_position) {
     auto     wall_start = std::chrono::steady_clock::now();
     uint64_t rdtsc_start = __rdtsc();
     int      chunks_regenerated = 0;
+    int      chunks_from_cache  = 0;
     int64_t  total_faces_generated = 0;
     int      sector_count = 0;
 
+    const mesh_gen_ctx_t ctx = Mesh_Gen_Context();
+    if ((ctx.arena != nullptr) != built_mesh_arena) {
+        lod_mesh_cache.Clear();
+        mesh_arena.Clear();
+    }
+    built_mesh_format = settings.mesh_format;
+    built_mesh_arena  = ctx.arena != nullptr;
+
     // 3) Optionally update LODs
     if (settings.use_lod) {
         Update_Chunk_LODs(player_position);
@@ -229,28 +913,18 @@ void WorldManager::Force_Generate_Meshes(glm::vec3 player_position) {
         auto* chunks = sector_ptr->Get_All_Chunks();
         for (auto [chunk_pos, chunk_ptr] : *chunks) {
             chunk_data_t& data = chunk_ptr->Get_Chunk_Data();
+            chunk_ptr->Mark_Sections_Dirty(ALL_SECTIONS);
 
-            // Validate lod directly on data.l_o_d
-            if (data.l_o_d == lod_Level_t::UNSET || static_cast<int>(data.l_o_d) <= 0) {
-                data.l_o_d = lod_Level_t::NORMAL;
-            }
-
-            int faces = (data.l_o_d == lod_Level_t::NORMAL)
-                ? Generate_Chunk_Mesh(
-                    world,
-                    { sector_pos, sector_ptr },
-                    { chunk_pos, chunk_ptr },
-                    settings.generic_chunk
-                )
-                : Generate_Chunk_Mesh(
-                    world,
-                    { sector_pos, sector_ptr },
-                    { chunk_pos, chunk_ptr },
-                    settings.generic_chunk,
-                    static_cast<int>(data.l_o_d)
-                );
+            bool from_cache = false;
+            int faces = Build_Chunk_Mesh(
+                { sector_pos, sector_ptr },
+                { chunk_pos, chunk_ptr },
+                ctx,
+                &from_cache
+            );
 
             total_faces_generated += faces;
+            chunks_from_cache     += from_cache;
             data.updated = false;
             ++chunks_regenerated;
         }
@@ -281,8 +955,12 @@ void WorldManager::Force_Generate_Meshes(glm::vec3 player_position) {
         << "Sectors processed           = " << sector_count << "\n"
         << "Chunks regenerated          = " << chunks_regenerated
         << " (" << chunks_per_s << " chunks/s)\n"
+        << "Chunks from mesh cache      = " << chunks_from_cache << "\n"
         << "Faces generated             = " << total_faces_generated
         << " (" << faces_per_s << " faces/s)\n"
         << "Average faces per chunk     = " << avg_faces_per_chunk << "\n"
+        << "Scratch peak usage          = " << Get_Mesh_Scratch().Get_Peak_Bytes() << " bytes"
+        << " (capacity " << Get_Mesh_Scratch().Get_Capacity_Bytes() << " bytes, "
+        << Get_Mesh_Scratch().grow_count << " grows)\n"
         << "===========================================================\n";
 }
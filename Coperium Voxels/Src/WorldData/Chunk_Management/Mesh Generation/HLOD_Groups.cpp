@@ -0,0 +1,372 @@
+#include "HLOD_Groups.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <GLM/gtc/matrix_transform.hpp>
+
+/* ============================================================================
+ * --------------------------- Cell_Index
+ * Index of a coarse cell in a group's cell grid.
+ * ============================================================================ */
+static inline int Cell_Index(int x, int y, int z) {
+    return (x * HLOD_CELLS_Y + y) * HLOD_CELLS_Z + z;
+}
+
+/* ============================================================================
+ * --------------------------- Hash_Cell
+ * Folds one coarse cell into an FNV-1a style running hash.
+ * ============================================================================ */
+static inline uint64_t Hash_Cell(uint64_t hash, const mip_cell_t& cell) {
+    for (uint16_t value : { cell.count, cell.r, cell.g, cell.b }) {
+        hash ^= value;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/* ============================================================================
+ * --------------------------- Group_Key
+ * Packs a sector and a group index within it into one map key.
+ * ============================================================================ */
+uint64_t HLOD_Groups::Group_Key(const sector_loc_t& sector, const glm::ivec3& group) {
+    return (static_cast<uint64_t>(sector.location) << 32) |
+           (static_cast<uint64_t>(group.x & 0xFF) << 16)  |
+           (static_cast<uint64_t>(group.z & 0xFF) <<  8)  |
+           (static_cast<uint64_t>(group.y & 0xFF) <<  0);
+}
+
+/* ============================================================================
+ * --------------------------- Group_Of
+ * The group a chunk belongs to. y rounds towards negative infinity so the
+ * chunks below 0 form their own groups.
+ * ============================================================================ */
+glm::ivec3 HLOD_Groups::Group_Of(const chunk_loc_t& chunk) {
+    const int y = chunk.Y();
+    return glm::ivec3(
+        chunk.X() / HLOD_GROUP_CHUNKS_X,
+        (y < 0 ? y - (HLOD_GROUP_CHUNKS_Y - 1) : y) / HLOD_GROUP_CHUNKS_Y,
+        chunk.Z() / HLOD_GROUP_CHUNKS_Z
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Group_Origin
+ * World position of the first voxel of a group.
+ * ============================================================================ */
+glm::vec3 HLOD_Groups::Group_Origin(const sector_loc_t& sector, const glm::ivec3& group) {
+    return glm::vec3(
+        sector.X() * SECTR_SIZE_X + group.x * HLOD_GROUP_CHUNKS_X * CHUNK_SIZE_X,
+                                    group.y * HLOD_GROUP_CHUNKS_Y * CHUNK_SIZE_Y,
+        sector.Z() * SECTR_SIZE_Z + group.z * HLOD_GROUP_CHUNKS_Z * CHUNK_SIZE_Z
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Group_Transform
+ * Model matrix taking a group mesh from coarse cells to world space. A unit
+ * cube at cell c spans c - 0.5 .. c + 0.5 and has to land on the voxels
+ * origin + c * HLOD_CELL_SIZE - 0.5 .. + HLOD_CELL_SIZE, the same half voxel
+ * shift every chunk mesh has.
+ * ============================================================================ */
+glm::mat4 HLOD_Groups::Group_Transform(const sector_loc_t& sector, const glm::ivec3& group) {
+    const glm::vec3 shift = Group_Origin(sector, group) + glm::vec3(HLOD_CELL_SIZE * 0.5f - 0.5f);
+    return glm::scale(glm::translate(glm::mat4(1.0f), shift), glm::vec3(static_cast<float>(HLOD_CELL_SIZE)));
+}
+
+/* ============================================================================
+ * --------------------------- Group_Distance
+ * Distance from the camera to the nearest point of a group's box (0 inside).
+ * ============================================================================ */
+float HLOD_Groups::Group_Distance(
+    const sector_loc_t& sector,
+    const glm::ivec3&   group,
+    const glm::vec3&    camera
+) {
+    glm::vec3 box_min, box_max;
+    Chunk_Box(Group_Origin(sector, group), box_min, box_max, glm::vec3(
+        HLOD_GROUP_CHUNKS_X * CHUNK_SIZE_X,
+        HLOD_GROUP_CHUNKS_Y * CHUNK_SIZE_Y,
+        HLOD_GROUP_CHUNKS_Z * CHUNK_SIZE_Z
+    ));
+    return glm::length(camera - glm::clamp(camera, box_min, box_max));
+}
+
+/* ============================================================================
+ * --------------------------- Build_Group
+ * Builds the CPU half of a group mesh into the scratch arena: gathers the
+ * LOD_16 mip cell of every loaded member into a coarse grid, then adds one
+ * cube per non empty cell with the faces against other non empty cells of
+ * the group left out. Faces on the group's border are always kept.
+ *
+ * ------ Parameters ------
+ * world     : The world holding the members
+ * sector    : Sector holding the group
+ * group     : Group index within the sector
+ * format    : Mesh format to build, into scratch.vertex_mesh or face_mesh
+ * scratch   : Arena the mesh is built in (reset first)
+ * members   : Optional, set to the number of loaded members
+ * signature : Optional, set to a hash of the grid and format; equal
+ *             signatures give equal meshes
+ *
+ * ------ Returns ------
+ * The number of faces built
+ * ============================================================================ */
+int HLOD_Groups::Build_Group(
+    World&              world,
+    const sector_loc_t& sector,
+    const glm::ivec3&   group,
+    mesh_format_t       format,
+    mesh_scratch_t&     scratch,
+    int*                members,
+    uint64_t*           signature
+) {
+    constexpr int CHUNK_CELLS_X = CHUNK_SIZE_X / HLOD_CELL_SIZE;
+    constexpr int CHUNK_CELLS_Y = CHUNK_SIZE_Y / HLOD_CELL_SIZE;
+    constexpr int CHUNK_CELLS_Z = CHUNK_SIZE_Z / HLOD_CELL_SIZE;
+
+    thread_local std::array<mip_cell_t, HLOD_CELLS> cells;
+    cells.fill(mip_cell_t());
+    scratch.Reset();
+
+    int loaded = 0;
+    std::shared_ptr<Sector>* sector_ptr = world.Get_All_Sectrs()->Find(sector);
+    if (sector_ptr && *sector_ptr) {
+        chunks_t* chunks = (*sector_ptr)->Get_All_Chunks();
+
+        for (int cx = 0; cx < HLOD_GROUP_CHUNKS_X; ++cx) {
+            for (int cy = 0; cy < HLOD_GROUP_CHUNKS_Y; ++cy) {
+                const int chunk_y = group.y * HLOD_GROUP_CHUNKS_Y + cy;
+                if (chunk_y < MIN_ID_C_Y || chunk_y > MAX_ID_C_Y) continue;
+
+                for (int cz = 0; cz < HLOD_GROUP_CHUNKS_Z; ++cz) {
+                    std::shared_ptr<Chunk>* chunk_ptr = chunks->Find(chunk_loc_t::Compact(glm::ivec3(
+                        group.x * HLOD_GROUP_CHUNKS_X + cx, chunk_y, group.z * HLOD_GROUP_CHUNKS_Z + cz
+                    )));
+                    if (!chunk_ptr || !*chunk_ptr) continue;
+                    ++loaded;
+
+                    const Chunk_Mip& mip = (*chunk_ptr)->Get_Mip();
+                    for (int x = 0; x < CHUNK_CELLS_X; ++x) {
+                        for (int y = 0; y < CHUNK_CELLS_Y; ++y) {
+                            for (int z = 0; z < CHUNK_CELLS_Z; ++z) {
+                                cells[Cell_Index(cx * CHUNK_CELLS_X + x, cy * CHUNK_CELLS_Y + y, cz * CHUNK_CELLS_Z + z)] =
+                                    mip.Get_Cell({ x * HLOD_CELL_SIZE, y * HLOD_CELL_SIZE, z * HLOD_CELL_SIZE }, HLOD_CELL_SIZE);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    if (members) *members = loaded;
+
+    if (signature) {
+        uint64_t hash = 0xCBF29CE484222325ull ^ static_cast<uint64_t>(format);
+        for (const mip_cell_t& cell : cells) hash = Hash_Cell(hash, cell);
+        *signature = hash;
+    }
+
+    auto filled = [&](int x, int y, int z) {
+        if (x < 0 || x >= HLOD_CELLS_X || y < 0 || y >= HLOD_CELLS_Y || z < 0 || z >= HLOD_CELLS_Z) return false;
+        return cells[Cell_Index(x, y, z)].count > 0;
+    };
+
+    using u8 = std::underlying_type_t<cube_faces_t>;
+    int num_faces     = 0;
+    int vertex_offset = 0;
+
+    for (int x = 0; x < HLOD_CELLS_X; ++x) {
+        for (int y = 0; y < HLOD_CELLS_Y; ++y) {
+            for (int z = 0; z < HLOD_CELLS_Z; ++z) {
+                const mip_cell_t& cell = cells[Cell_Index(x, y, z)];
+                if (cell.count == 0) continue;
+
+                const cube_faces_t faces = static_cast<cube_faces_t>(
+                    (static_cast<u8>(!filled(x + 1, y, z)) << RIGHT_SHIFT ) |
+                    (static_cast<u8>(!filled(x - 1, y, z)) << LEFT_SHIFT  ) |
+                    (static_cast<u8>(!filled(x, y + 1, z)) << TOP_SHIFT   ) |
+                    (static_cast<u8>(!filled(x, y - 1, z)) << BOTTOM_SHIFT) |
+                    (static_cast<u8>(!filled(x, y, z + 1)) << FRONT_SHIFT ) |
+                    (static_cast<u8>(!filled(x, y, z - 1)) << BACK_SHIFT  )
+                    );
+                if (!faces) continue;
+
+                const glm::vec3 colour = glm::vec3(cell.r, cell.g, cell.b) / static_cast<float>(cell.count);
+                num_faces += Count_Set_Bits(faces);
+
+                if (format == mesh_format_t::PACKED_FACE)
+                    Add_Cube_Face_Records(glm::ivec3(x, y, z), colour, scratch.face_mesh, faces);
+                else
+                    Add_Cube_Mesh_Fast(glm::ivec3(x, y, z), colour, scratch.vertex_mesh, vertex_offset, faces);
+            }
+        }
+    }
+
+    scratch.Record_Usage();
+    return num_faces;
+}
+
+/* ============================================================================
+ * --------------------------- Mark_Dirty
+ * Flags the group holding a chunk for a rebuild, adding the group if this
+ * is its first chunk.
+ * ============================================================================ */
+void HLOD_Groups::Mark_Dirty(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    const glm::ivec3 group = Group_Of(chunk);
+    auto [it, added] = groups.try_emplace(Group_Key(sector, group));
+    if (added) {
+        it->second.sector = sector;
+        it->second.group  = group;
+    }
+    it->second.dirty = true;
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every group mesh. Groups come back as their chunks are marked dirty.
+ * ============================================================================ */
+void HLOD_Groups::Clear() {
+    groups.clear();
+    build_order.clear();
+}
+
+/* ============================================================================
+ * --------------------------- Rebuild
+ * Rebuilds dirty groups that are, or are about to be, far enough to be
+ * drawn: nearest first, until `budget_ms` is spent (at least one per call so
+ * the work always moves on). A group whose cells did not change keeps its
+ * mesh without an upload, and one with no members left is removed.
+ *
+ * ------ Parameters ------
+ * world     : The world holding the members
+ * ctx       : Mesh format and shared resources owned by the renderer
+ * camera    : Camera position
+ * distance  : HLOD distance; groups within HLOD_PREBUILD_MARGIN of it count
+ * budget_ms : Time allowed this call (0 = no limit)
+ * ============================================================================ */
+void HLOD_Groups::Rebuild(
+    World&                  world,
+    const mesh_gen_ctx_t&   ctx,
+    const glm::vec3&        camera,
+    float                   distance,
+    float                   budget_ms
+) {
+    const auto start = std::chrono::steady_clock::now();
+    stats.groups_built = 0;
+    stats.elapsed_ms   = 0.0;
+
+    build_order.clear();
+    for (auto& [key, entry] : groups) {
+        if ((entry.dirty || entry.format != ctx.format) &&
+            Group_Distance(entry.sector, entry.group, camera) >= distance - HLOD_PREBUILD_MARGIN) {
+            build_order.push_back(&entry);
+        }
+    }
+    std::sort(build_order.begin(), build_order.end(),
+        [&](const hlod_group_t* a, const hlod_group_t* b) {
+            return Group_Distance(a->sector, a->group, camera) < Group_Distance(b->sector, b->group, camera);
+        });
+
+    size_t next = 0;
+    for (; next < build_order.size(); ++next) {
+        if (budget_ms > 0.0f && stats.groups_built > 0 && stats.elapsed_ms >= budget_ms) break;
+
+        hlod_group_t& entry = *build_order[next];
+        mesh_scratch_t& scratch = Get_Mesh_Scratch();
+
+        int      members   = 0;
+        uint64_t signature = 0;
+        const int faces = Build_Group(world, entry.sector, entry.group, ctx.format, scratch, &members, &signature);
+
+        if (members == 0) {
+            groups.erase(Group_Key(entry.sector, entry.group));
+        }
+        else {
+            if (!entry.built || entry.signature != signature || entry.format != ctx.format) {
+                if (ctx.upload) {
+                    Upload_Mesh_Data(entry.mesh, scratch.vertex_mesh, scratch.face_mesh, faces, ctx);
+                }
+                entry.num_faces = faces;
+                entry.format    = ctx.format;
+                entry.signature = signature;
+                entry.built     = true;
+            }
+            entry.members = members;
+            entry.dirty   = false;
+        }
+
+        ++stats.groups_built;
+        stats.elapsed_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start
+        ).count();
+    }
+
+    stats.groups         = static_cast<int>(groups.size());
+    stats.groups_pending = static_cast<int>(build_order.size() - next);
+}
+
+/* ============================================================================
+ * --------------------------- Draw_Far
+ * Draws every built group beyond `distance` in one call each and flags it
+ * so Is_Drawn can skip its chunks. Group meshes go through the model matrix
+ * with a zero vertex offset; the model matrix is set back to identity after.
+ *
+ * ------ Parameters ------
+ * shader        : The bound G-buffer shader
+ * vertex_offset : Location of its vertex_offset uniform
+ * camera        : Camera position
+ * distance      : HLOD distance
+ * format        : Active mesh format; groups built in another are skipped
+ * skip_sector   : Optional, true for sectors drawn some other way
+ *
+ * ------ Returns ------
+ * The number of groups drawn
+ * ============================================================================ */
+int HLOD_Groups::Draw_Far(
+    const Coil::Shader& shader,
+    GLuint              vertex_offset,
+    const glm::vec3&    camera,
+    float               distance,
+    mesh_format_t       format,
+    const std::function<bool(const sector_loc_t&)>& skip_sector
+) {
+    stats.groups_drawn    = 0;
+    stats.chunks_replaced = 0;
+    stats.faces_drawn     = 0;
+
+    for (auto& [key, entry] : groups) {
+        entry.drawn = entry.built && entry.format == format &&
+                      Group_Distance(entry.sector, entry.group, camera) > distance &&
+                      !(skip_sector && skip_sector(entry.sector));
+        if (!entry.drawn) continue;
+
+        if (stats.groups_drawn == 0) shader.Set_Vec3(vertex_offset, glm::vec3(0.0f));
+        shader.Set_Matrix4("model", Group_Transform(entry.sector, entry.group));
+        if (entry.num_faces > 0) entry.mesh.Draw_Mesh(false);
+
+        ++stats.groups_drawn;
+        stats.chunks_replaced += entry.members;
+        stats.faces_drawn     += entry.num_faces;
+    }
+
+    if (stats.groups_drawn > 0) shader.Set_Matrix4("model", glm::mat4(1.0f));
+    return stats.groups_drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Is_Drawn
+ * Whether the group holding a chunk was drawn by the last Draw_Far.
+ * ============================================================================ */
+bool HLOD_Groups::Is_Drawn(const sector_loc_t& sector, const chunk_loc_t& chunk) const {
+    auto it = groups.find(Group_Key(sector, Group_Of(chunk)));
+    return it != groups.end() && it->second.drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Stats
+ * Returns last frame's rebuild and draw counts.
+ * ============================================================================ */
+const hlod_stats_t& HLOD_Groups::Get_Stats() const {
+    return stats;
+}
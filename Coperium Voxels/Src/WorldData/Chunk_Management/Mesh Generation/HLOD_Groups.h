@@ -0,0 +1,143 @@
+#pragma once
+#ifndef HLOD_GROUPS_H
+#define HLOD_GROUPS_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <GLM/glm.hpp>
+
+#include "Chunk_Mesh.h"
+#include <COIL/Shaders/Shader.h>
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int HLOD_GROUP_CHUNKS_X   = 8;    // Chunks per group along x
+constexpr int HLOD_GROUP_CHUNKS_Y   = 16;   // Chunks per group along y
+constexpr int HLOD_GROUP_CHUNKS_Z   = 8;    // Chunks per group along z
+constexpr int HLOD_CELL_SIZE        = 16;   // Voxels per coarse cell (the LOD_16 mip level)
+
+constexpr int HLOD_CELLS_X = HLOD_GROUP_CHUNKS_X * CHUNK_SIZE_X / HLOD_CELL_SIZE;  //  8
+constexpr int HLOD_CELLS_Y = HLOD_GROUP_CHUNKS_Y * CHUNK_SIZE_Y / HLOD_CELL_SIZE;  // 64
+constexpr int HLOD_CELLS_Z = HLOD_GROUP_CHUNKS_Z * CHUNK_SIZE_Z / HLOD_CELL_SIZE;  //  8
+constexpr int HLOD_CELLS   = HLOD_CELLS_X * HLOD_CELLS_Y * HLOD_CELLS_Z;
+
+constexpr float HLOD_PREBUILD_MARGIN = 64.0f;   // Groups this much inside the HLOD distance are kept built
+
+// Coarse cells are meshed as local positions, so a group must fit both
+// packed formats (CFD: 4 / 6 / 4 bits, CLD: +-15 / +-63 / +-15).
+static_assert(HLOD_CELLS_X <= 16 && HLOD_CELLS_Y <= 64 && HLOD_CELLS_Z <= 16,
+              "HLOD group does not fit the packed mesh formats");
+static_assert(NUM_CHUNKS_X % HLOD_GROUP_CHUNKS_X == 0 &&
+              NUM_CHUNKS_Z % HLOD_GROUP_CHUNKS_Z == 0,
+              "HLOD groups must tile a sector");
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: hlod_group_t                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One merged far field mesh covering a block of chunks. The mesh stays
+ * drawable while the group is dirty and is only replaced once the rebuild
+ * is done. Never copied: the mesh owns GL objects.
+ * ============================================================================ */
+typedef struct hlod_group_t {
+    sector_loc_t        sector;
+    glm::ivec3          group       = glm::ivec3(0);    // Group index within the sector
+    Coil::Basic_Mesh    mesh;
+    mesh_format_t       format      = mesh_format_t::PACKED_VERTEX;
+    int                 num_faces   = 0;
+    int                 members     = 0;        // Chunks that went into the mesh
+    uint64_t            signature   = 0;        // Hash of the coarse cells it was built from
+    bool                built       = false;    // mesh describes the group (maybe stale)
+    bool                dirty       = true;     // A member changed since the build
+    bool                drawn       = false;    // Drawn in place of its chunks this frame
+} hlod_group_t;
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: hlod_stats_t                             //
+//----------------------------------------------------------------------------//
+typedef struct hlod_stats_t {
+    int     groups          = 0;    // Groups with at least one loaded chunk
+    int     groups_built    = 0;    // Rebuilt this frame
+    int     groups_pending  = 0;    // Far dirty groups left for later frames
+    int     groups_drawn    = 0;    // Groups drawn this frame
+    int     chunks_replaced = 0;    // Chunks those draws stood in for
+    int     faces_drawn     = 0;    // Faces those draws submitted
+    double  elapsed_ms      = 0.0;  // Time spent rebuilding this frame
+} hlod_stats_t;
+
+//----------------------------------------------------------------------------//
+//                            CLASS: HLOD_Groups                              //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Merged far field meshes, one per HLOD_GROUP_CHUNKS_X x _Y x _Z block of
+ * chunks.
+ *
+ * A group mesh is built straight from its members' LOD_16 mip cells, one
+ * cube per non empty cell with faces between two filled cells dropped, so
+ * a group costs one draw however many chunks it holds. Positions are in
+ * coarse cell units and Group_Transform scales them back into the world
+ * through the shader's model matrix, which lets both packed formats carry
+ * a whole group in their local position bits.
+ *
+ * Members only flag their group dirty. Rebuild then remakes the dirty
+ * groups that are far enough to be drawn, nearest first, within a time
+ * budget, while the previous mesh keeps being drawn; nearer groups wait
+ * until the camera moves away from them.
+ * ============================================================================ */
+class HLOD_Groups {
+public:
+    void    Mark_Dirty  (const sector_loc_t& sector, const chunk_loc_t& chunk);
+    void    Clear       ();
+
+    void    Rebuild     (
+        World&                  world,
+        const mesh_gen_ctx_t&   ctx,
+        const glm::vec3&        camera,
+        float                   distance,
+        float                   budget_ms
+    );
+    int     Draw_Far    (
+        const Coil::Shader&     shader,
+        GLuint                  vertex_offset,
+        const glm::vec3&        camera,
+        float                   distance,
+        mesh_format_t           format,
+        const std::function<bool(const sector_loc_t&)>& skip_sector = nullptr
+    );
+    bool    Is_Drawn    (const sector_loc_t& sector, const chunk_loc_t& chunk) const;
+
+    const hlod_stats_t& Get_Stats() const;
+
+    static glm::ivec3   Group_Of        (const chunk_loc_t& chunk);
+    static glm::vec3    Group_Origin    (const sector_loc_t& sector, const glm::ivec3& group);
+    static glm::mat4    Group_Transform (const sector_loc_t& sector, const glm::ivec3& group);
+    static float        Group_Distance  (
+        const sector_loc_t&     sector,
+        const glm::ivec3&       group,
+        const glm::vec3&        camera
+    );
+    static int          Build_Group     (
+        World&                  world,
+        const sector_loc_t&     sector,
+        const glm::ivec3&       group,
+        mesh_format_t           format,
+        mesh_scratch_t&         scratch,
+        int*                    members     = nullptr,
+        uint64_t*               signature   = nullptr
+    );
+
+private:
+    static uint64_t     Group_Key(const sector_loc_t& sector, const glm::ivec3& group);
+
+    std::unordered_map<uint64_t, hlod_group_t>  groups;
+    std::vector<hlod_group_t*>                  build_order;    // Reused by Rebuild
+    hlod_stats_t                                stats;
+};
+
+#endif // !HLOD_GROUPS_H
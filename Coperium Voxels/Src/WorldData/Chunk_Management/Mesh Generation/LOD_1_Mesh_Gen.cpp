@@ -1,68 +1,228 @@
 #include "Chunk_Mesh.h"
+#include "Mesh_Scratch.h"
 #include "../../../Compact Data/Cube Mesh/CCMS.h"
 #include "../../World Opertions/Wrap Operations/Wrap_Voxel_Operations.h"
 #include <bitset>
 
 
+/* ============================================================================
+ * --------------------------- Voxel_Face_Flags
+ * Returns the faces of a solid voxel that border air, or no faces if the
+ * voxel itself is air.
+ * ============================================================================ */
+static inline cube_faces_t Voxel_Face_Flags(
+    const neighbouring_chunks_t&    c_neighbours,
+    Chunk&                          chunk,
+    int x, int y, int z
+) {
+    if (!chunk.Get_Voxel(glm::ivec3(x, y, z), rel_loc_t::CHUNK_LOC)->IsSolid())
+        return static_cast<cube_faces_t>(0);
 
-int Generate_Chunk_Mesh(World& w, sector_pair_t sector_pair, chunk_pair_t chunk_pair, const Chunk& generic_chunk) {
+    return static_cast<cube_faces_t>(
+        ((c_neighbours.Get_Right(x)->Get_Voxel(glm::ivec3(vox_inc_x(x), y, z))->IsAir()) << 3) | // RIGHT_FACE
+        ((c_neighbours.Get_Left (x)->Get_Voxel(glm::ivec3(vox_dec_x(x), y, z))->IsAir()) << 2) | // LEFT_FACE
+        ((c_neighbours.Get_Up   (y)->Get_Voxel(glm::ivec3(x, vox_inc_y(y), z))->IsAir()) << 4) | // TOP_FACE
+        ((c_neighbours.Get_Down (y)->Get_Voxel(glm::ivec3(x, vox_dec_y(y), z))->IsAir()) << 5) | // BOTTOM_FACE
+        ((c_neighbours.Get_Front(z)->Get_Voxel(glm::ivec3(x, y, vox_inc_z(z)))->IsAir()) << 0) | // FRONT_FACE
+        ((c_neighbours.Get_Back (z)->Get_Voxel(glm::ivec3(x, y, vox_dec_z(z)))->IsAir()) << 1)   // BACK_FACE
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Count_Section_Faces
+ * First pass of the two pass mesher: computes every voxel's visibility mask
+ * in one section and sums their popcounts, without writing any mesh data.
+ *
+ * ------ Parameters ------
+ * c_neighbours   : The chunk and its six neighbours.
+ * chunk          : The chunk being counted.
+ * section        : Section index (0 = bottom).
+ * masks          : Optional, receives SECTION_VOXELS masks in mesher order.
+ * visible_voxels : Optional, receives how many voxels have any face.
+ *
+ * ------ Returns ------
+ * The number of faces the section will have.
+ * ============================================================================ */
+int Count_Section_Faces(
+    const neighbouring_chunks_t&    c_neighbours,
+    Chunk&                          chunk,
+    int                             section,
+    uint8_t*                        masks,
+    int*                            visible_voxels
+) {
+    const int min_y = section * SECTION_SIZE_Y;
+    const int max_y = min_y + SECTION_SIZE_Y - 1;
+
+    int faces   = 0;
+    int visible = 0;
+    for (int x = MIN_ID_V_X; x <= MAX_ID_V_X; x++) {
+        for (int y = min_y; y <= max_y; y++) {
+            for (int z = MIN_ID_V_Z; z <= MAX_ID_V_Z; z++) {
+                const cube_faces_t flags = Voxel_Face_Flags(c_neighbours, chunk, x, y, z);
+                if (masks) *masks++ = flags;
+
+                faces   += Count_Set_Bits(flags);
+                visible += flags != 0;
+            }
+        }
+    }
+
+    if (visible_voxels) *visible_voxels = visible;
+    return faces;
+}
+
+/* ============================================================================
+ * --------------------------- Count_Chunk_Faces
+ * Runs only the counting pass over the given sections of a full detail
+ * chunk. Lets the scheduler size a mesh before building it.
+ *
+ * ------ Returns ------
+ * The number of faces the sections will have.
+ * ============================================================================ */
+int Count_Chunk_Faces(
+    World&          w,
+    sector_pair_t   sector_pair,
+    chunk_pair_t    chunk_pair,
+    const Chunk&    generic_chunk,
+    int             sections
+) {
     const neighbouring_chunks_t c_neighbours =
         get_chunk_neighbours(w, chunk_pair, sector_pair, generic_chunk);
 
-    std::vector<GLfloat>    vertex_mesh;
-    std::vector<GLuint >    index_mesh;
-    vertex_mesh.reserve(static_cast<size_t>(16) * 1024);
-    index_mesh.reserve(static_cast<size_t>(4) * 1024);
-    int vertex_offset = 0;
-    int index_offset = 0;
+    int faces = 0;
+    for (int section = 0; section < NUM_SECTIONS; section++) {
+        if (!(sections & (1 << section))) continue;
+        faces += Count_Section_Faces(c_neighbours, *chunk_pair.second, section, nullptr, nullptr);
+    }
+    return faces;
+}
 
-    int total_faces_generated = 0;
+/* ============================================================================
+ * --------------------------- Write_Section_Exact
+ * Two pass build of one section. The counting pass fills the scratch masks
+ * and gives the exact face count, the buffer is sized once, and the write
+ * pass stores each face at its final position through a raw pointer.
+ *
+ * ------ Returns ------
+ * The number of faces written.
+ * ============================================================================ */
+static int Write_Section_Exact(
+    const neighbouring_chunks_t&    c_neighbours,
+    Chunk&                          chunk,
+    int                             section,
+    mesh_scratch_t&                 scratch,
+    const mesh_gen_ctx_t&           ctx
+) {
+    int visible = 0;
+    const int faces = Count_Section_Faces(
+        c_neighbours, chunk, section, scratch.face_masks.data(), &visible
+    );
+    scratch.face_slots.reserve(static_cast<size_t>(visible));
+
+    GLfloat* vertex_out = nullptr;
+    GLuint*  face_out   = nullptr;
+    if (ctx.format == mesh_format_t::PACKED_FACE) {
+        scratch.face_mesh.resize(static_cast<size_t>(faces) * CFD::WORDS_PER_FACE);
+        face_out = scratch.face_mesh.data();
+    }
+    else {
+        scratch.vertex_mesh.resize(static_cast<size_t>(faces) * FACE_VERT_SIZE);
+        vertex_out = scratch.vertex_mesh.data();
+    }
+
+    const int      min_y = section * SECTION_SIZE_Y;
+    const int      max_y = min_y + SECTION_SIZE_Y - 1;
+    const uint8_t* mask  = scratch.face_masks.data();
+    int            face  = 0;
 
     for (int x = MIN_ID_V_X; x <= MAX_ID_V_X; x++) {
-        for (int y = MIN_ID_V_Y; y <= MAX_ID_V_Y; y++) {
+        for (int y = min_y; y <= max_y; y++) {
             for (int z = MIN_ID_V_Z; z <= MAX_ID_V_Z; z++) {
-                Voxel* voxel = chunk_pair.second.get()->Get_Voxel(glm::ivec3(x, y, z), rel_loc_t::CHUNK_LOC);
-                if (!voxel->IsSolid()) continue;
-
-                cube_faces_t flags = static_cast<cube_faces_t>(
-                    ((c_neighbours.Get_Right(x)->Get_Voxel(glm::ivec3(vox_inc_x(x), y, z))->IsAir()) << 3) | // RIGHT_FACE
-                    ((c_neighbours.Get_Left (x)->Get_Voxel(glm::ivec3(vox_dec_x(x), y, z))->IsAir()) << 2) | // LEFT_FACE
-                    ((c_neighbours.Get_Up   (y)->Get_Voxel(glm::ivec3(x, vox_inc_y(y), z))->IsAir()) << 4) | // TOP_FACE
-                    ((c_neighbours.Get_Down (y)->Get_Voxel(glm::ivec3(x, vox_dec_y(y), z))->IsAir()) << 5) | // BOTTOM_FACE
-                    ((c_neighbours.Get_Front(z)->Get_Voxel(glm::ivec3(x, y, vox_inc_z(z)))->IsAir()) << 0) | // FRONT_FACE
-                    ((c_neighbours.Get_Back (z)->Get_Voxel(glm::ivec3(x, y, vox_dec_z(z)))->IsAir()) << 1)   // BACK_FACE
-                );
-
-                total_faces_generated += Count_Set_Bits(flags); // Now local to this function
-
-                Add_Cube_Mesh(
-                    glm::ivec3(x, y, z),
-                    voxel->GetColour(),
-                    vertex_mesh, index_mesh,
-                    vertex_offset, index_offset,
-                    flags
-                );
+                const cube_faces_t flags = static_cast<cube_faces_t>(*mask++);
+                if (!flags) continue;
+
+                const glm::vec3 colour = chunk.Get_Voxel(glm::ivec3(x, y, z), rel_loc_t::CHUNK_LOC)->GetColour();
+
+                Record_Face_Slot(scratch.face_slots, glm::ivec3(x, y, z), face, flags);
+                face += Count_Set_Bits(flags);
+
+                if (face_out) face_out   = Write_Cube_Face_Records(glm::ivec3(x, y, z), colour, face_out  , flags);
+                else          vertex_out = Write_Cube_Mesh_Fast   (glm::ivec3(x, y, z), colour, vertex_out, flags);
             }
         }
     }
 
-    chunk_pair.second.get()->Get_Mesh().Clear_Mesh();
-    chunk_pair.second.get()->Get_Mesh().Configure_Mesh(
-        vertex_mesh.data(),
-        sizeof(GLfloat),
-        (GLsizei)vertex_mesh.size(),
-        GL_FLOAT,
-        FACE_NUM_ELEMENTS
-    );
-    chunk_pair.second.get()->Get_Mesh().Configure_Index_Buffer(
-        index_mesh.data(),
-        sizeof(GLuint),
-        (GLsizei)index_mesh.size()
-    );
+    return faces;
+}
+
+int Generate_Chunk_Mesh(World& w, sector_pair_t sector_pair, chunk_pair_t chunk_pair, const Chunk& generic_chunk, const mesh_gen_ctx_t& ctx) {
+    const neighbouring_chunks_t c_neighbours =
+        get_chunk_neighbours(w, chunk_pair, sector_pair, generic_chunk);
+
+    mesh_scratch_t&         scratch     = Get_Mesh_Scratch();
+    std::vector<GLfloat>&   vertex_mesh = scratch.vertex_mesh;
+    std::vector<GLuint >&   face_mesh   = scratch.face_mesh;
+
+    const int sections = chunk_pair.second->Take_Build_Sections(ctx.max_sections);
+    int total_faces_generated = 0;
+
+    for (int section = 0; section < NUM_SECTIONS; section++) {
+        if (!(sections & (1 << section))) continue;
+
+        scratch.Reset();
+        scratch.has_face_slots = true;
 
-    chunk_pair.second.get()->Get_Mesh().Add_Vertex_Set(0, 1, 0);
-    chunk_pair.second.get()->Get_Mesh().Add_Vertex_Set(1, 1, 1);
-    chunk_pair.second.get()->Get_Mesh().Add_Vertex_Set(2, 1, 2);
+        if (ctx.two_pass) {
+            const int section_faces = Write_Section_Exact(
+                c_neighbours, *chunk_pair.second, section, scratch, ctx
+            );
+            scratch.Record_Usage();
+            Upload_Chunk_Mesh(*chunk_pair.second, section, scratch, section_faces, ctx);
+            total_faces_generated += section_faces;
+            continue;
+        }
+
+        int vertex_offset = 0;
+        int section_faces = 0;
+
+        const int min_y = section * SECTION_SIZE_Y;
+        const int max_y = min_y + SECTION_SIZE_Y - 1;
+
+        for (int x = MIN_ID_V_X; x <= MAX_ID_V_X; x++) {
+            for (int y = min_y; y <= max_y; y++) {
+                for (int z = MIN_ID_V_Z; z <= MAX_ID_V_Z; z++) {
+                    cube_faces_t flags = Voxel_Face_Flags(c_neighbours, *chunk_pair.second, x, y, z);
+                    if (!flags) continue;
+
+                    Voxel* voxel = chunk_pair.second.get()->Get_Voxel(glm::ivec3(x, y, z), rel_loc_t::CHUNK_LOC);
+
+                    Record_Face_Slot(scratch.face_slots, glm::ivec3(x, y, z), section_faces, flags);
+                    section_faces += Count_Set_Bits(flags);
+
+                    if (ctx.format == mesh_format_t::PACKED_FACE) {
+                        Add_Cube_Face_Records(
+                            glm::ivec3(x, y, z),
+                            voxel->GetColour(),
+                            face_mesh, flags
+                        );
+                    }
+                    else {
+                        Add_Cube_Mesh_Fast(
+                            glm::ivec3(x, y, z),
+                            voxel->GetColour(),
+                            vertex_mesh, vertex_offset,
+                            flags
+                        );
+                    }
+                }
+            }
+        }
+
+        scratch.Record_Usage();
+        Upload_Chunk_Mesh(*chunk_pair.second, section, scratch, section_faces, ctx);
+        total_faces_generated += section_faces;
+    }
 
+    Finish_Chunk_Build(*chunk_pair.second, ctx);
     return total_faces_generated;
 }
@@ -0,0 +1,212 @@
+#include "LOD_Mesh_Cache.h"
+#include "Chunk_Mesh.h"
+
+#include <iterator>
+#include <utility>
+
+/* ============================================================================
+ * --------------------------- Chunk_Id / Slot
+ * Pack a sector and chunk location into one key, then add the LOD.
+ * ============================================================================ */
+uint64_t LOD_Mesh_Cache::Chunk_Id(const sector_loc_t& sector, const chunk_loc_t& chunk_loc) {
+    return (static_cast<uint64_t>(sector.location) << 16) | chunk_loc.location;
+}
+
+uint64_t LOD_Mesh_Cache::Slot(uint64_t chunk_id, lod_Level_t l_o_d) {
+    return (chunk_id << 5) | (static_cast<uint64_t>(l_o_d) & 0x1F);
+}
+
+/* ============================================================================
+ * --------------------------- Mesh_Bytes
+ * GPU bytes of the parked sections plus their slot and order maps.
+ * ============================================================================ */
+size_t LOD_Mesh_Cache::Mesh_Bytes(const parked_mesh_t& parked) {
+    size_t bytes = 0;
+    for (const section_mesh_t& section : parked.sections) {
+        bytes += Mesh_Bytes_Per_Face(parked.format) * section.num_faces;
+        bytes += section.face_slots.capacity() * sizeof(face_slot_t);
+        bytes += section.face_order.capacity() * sizeof(uint16_t);
+    }
+    return bytes;
+}
+
+/* ============================================================================
+ * --------------------------- Exchange
+ * Swaps the chunk's uploaded mesh, and what it was built from, with a
+ * parked one.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Exchange(Chunk& chunk, parked_mesh_t& parked) {
+    chunk_data_t& data = chunk.Get_Chunk_Data();
+
+    chunk.Exchange_Meshes(parked.sections);
+    std::swap(data.mesh_format, parked.format);
+    std::swap(data.mesh_lod   , parked.l_o_d );
+    std::swap(data.mesh_key   , parked.key   );
+    std::swap(data.mesh_voxels, parked.voxels);
+}
+
+/* ============================================================================
+ * --------------------------- Swap_In
+ * Installs the mesh parked for the chunk's current LOD if it was built from
+ * the same inputs. The chunk's outgoing mesh takes its place in the cache
+ * when it was built from the same voxels, and is freed otherwise.
+ *
+ * ------ Parameters ------
+ * sector    : Sector holding the chunk
+ * chunk_loc : Chunk location within the sector
+ * chunk     : The chunk to give a mesh
+ * key       : Mesh_Cache_Key of the chunk as it is now
+ * format    : The mesh format being drawn
+ *
+ * ------ Returns ------
+ * true if a parked mesh was installed and the chunk needs no build
+ * ============================================================================ */
+bool LOD_Mesh_Cache::Swap_In(
+    const sector_loc_t& sector,
+    const chunk_loc_t&  chunk_loc,
+    Chunk&              chunk,
+    uint64_t            key,
+    mesh_format_t       format
+) {
+    chunk_data_t& data = chunk.Get_Chunk_Data();
+
+    auto found = slots.find(Slot(Chunk_Id(sector, chunk_loc), data.l_o_d));
+    if (found == slots.end()) return false;
+
+    const entry_it entry = found->second;
+    if (entry->key != key || entry->format != format) return false;
+
+    // Matching keys mean matching voxels, so this is the voxel hash now
+    const bool keep_outgoing = data.mesh_key != 0 && data.mesh_voxels == entry->voxels;
+
+    slots.erase(found);
+    stats.bytes -= entry->bytes;
+
+    Exchange(chunk, *entry);
+    chunk.Clear_Dirty_Sections();
+    ++stats.hits;
+
+    if (keep_outgoing) {
+        entry->bytes = Mesh_Bytes(*entry);
+        Insert(entry);
+    }
+    else {
+        entries.erase(entry);
+    }
+    Evict();
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Park
+ * Moves the chunk's uploaded mesh into the cache, leaving the chunk with
+ * empty sections to be rebuilt. Replaces anything parked for the same chunk
+ * and LOD.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Park(
+    const sector_loc_t& sector,
+    const chunk_loc_t&  chunk_loc,
+    Chunk&              chunk
+) {
+    entries.emplace_front();
+    const entry_it entry = entries.begin();
+    entry->chunk_id = Chunk_Id(sector, chunk_loc);
+    entry->format   = chunk.Get_Chunk_Data().mesh_format;
+
+    Exchange(chunk, *entry);
+    entry->bytes = Mesh_Bytes(*entry);
+    ++stats.parked;
+
+    Insert(entry);
+    Evict();
+}
+
+/* ============================================================================
+ * --------------------------- Insert
+ * Makes an entry the most recent and the one held for its chunk and LOD.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Insert(entry_it entry) {
+    entries.splice(entries.begin(), entries, entry);
+
+    auto [slot, inserted] = slots.try_emplace(Slot(entry->chunk_id, entry->l_o_d), entry);
+    if (!inserted) {
+        const entry_it replaced = slot->second;
+        slot->second = entry;
+        stats.bytes -= replaced->bytes;
+        entries.erase(replaced);
+    }
+    stats.bytes += entry->bytes;
+}
+
+/* ============================================================================
+ * --------------------------- Erase
+ * Frees an entry's meshes.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Erase(entry_it entry) {
+    slots.erase(Slot(entry->chunk_id, entry->l_o_d));
+    stats.bytes -= entry->bytes;
+    entries.erase(entry);
+}
+
+/* ============================================================================
+ * --------------------------- Evict
+ * Frees the least recently used entries until the cache fits its budget.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Evict() {
+    while (stats.bytes > budget && !entries.empty()) {
+        Erase(std::prev(entries.end()));
+        ++stats.evicted;
+    }
+    stats.entries = entries.size();
+}
+
+/* ============================================================================
+ * --------------------------- Drop
+ * Frees every mesh parked for a chunk, whatever its LOD. Called when the
+ * chunk unloads or loses its meshes, so they stop taking budget from
+ * chunks that are still loaded.
+ *
+ * ------ Returns ------
+ * The number of meshes freed
+ * ============================================================================ */
+int LOD_Mesh_Cache::Drop(const sector_loc_t& sector, const chunk_loc_t& chunk_loc) {
+    static constexpr lod_Level_t levels[] = {
+        lod_Level_t::UNSET, lod_Level_t::NORMAL, lod_Level_t::LOD_2,
+        lod_Level_t::LOD_4, lod_Level_t::LOD_8 , lod_Level_t::LOD_16
+    };
+
+    const uint64_t chunk_id = Chunk_Id(sector, chunk_loc);
+    int dropped = 0;
+    for (lod_Level_t l_o_d : levels) {
+        auto found = slots.find(Slot(chunk_id, l_o_d));
+        if (found == slots.end()) continue;
+        Erase(found->second);
+        ++dropped;
+    }
+    stats.entries = entries.size();
+    return dropped;
+}
+
+/* ============================================================================
+ * --------------------------- Set_Budget
+ * Sets the most parked mesh memory to keep, evicting down to it.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Set_Budget(size_t bytes) {
+    budget = bytes;
+    Evict();
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Frees every parked mesh.
+ * ============================================================================ */
+void LOD_Mesh_Cache::Clear() {
+    slots.clear();
+    entries.clear();
+    stats.bytes   = 0;
+    stats.entries = 0;
+}
+
+const lod_cache_stats_t& LOD_Mesh_Cache::Get_Stats() const {
+    return stats;
+}
@@ -0,0 +1,95 @@
+#pragma once
+#ifndef LOD_MESH_CACHE_H
+#define LOD_MESH_CACHE_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "../../CommonWD.h"
+#include "Section_Mesh.h"
+
+//----------------------------------------------------------------------------//
+//                          STRUCT: parked_mesh_t                             //
+//----------------------------------------------------------------------------//
+typedef struct parked_mesh_t {
+    uint64_t            chunk_id    = 0;    // Sector and chunk location
+    lod_Level_t         l_o_d       = lod_Level_t::UNSET;
+    mesh_format_t       format      = mesh_format_t::PACKED_VERTEX;
+    uint64_t            key         = 0;    // Mesh_Cache_Key it was built from
+    uint64_t            voxels      = 0;    // Hash of the voxels it was built from
+    size_t              bytes       = 0;    // Counted against the budget
+    section_mesh_t      sections[NUM_SECTIONS];     // Traded with the chunk's drawn meshes
+} parked_mesh_t;
+
+//----------------------------------------------------------------------------//
+//                       STRUCT: lod_cache_stats_t                            //
+//----------------------------------------------------------------------------//
+typedef struct lod_cache_stats_t {
+    int     hits        = 0;    // Meshes swapped back in instead of rebuilt
+    int     parked      = 0;    // Meshes moved into the cache
+    int     evicted     = 0;    // Meshes freed to stay under the budget
+    size_t  bytes       = 0;    // Bytes currently held
+    size_t  entries     = 0;    // Meshes currently held
+} lod_cache_stats_t;
+
+//----------------------------------------------------------------------------//
+//                          CLASS: LOD_Mesh_Cache                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Uploaded chunk meshes kept for reuse after the chunk moved on to another
+ * mesh, one per chunk and LOD.
+ *
+ * When a chunk is rebuilt without its own voxels having changed (its LOD or
+ * a neighbour changed), the outgoing mesh is parked here instead of freed.
+ * A later build whose Mesh_Cache_Key and format match a parked mesh for the
+ * chunk's LOD swaps it back in, handing the outgoing mesh to the cache in
+ * its place, so moving back and forth over a LOD threshold costs no mesher
+ * work and no upload.
+ *
+ * The total size of parked meshes is kept under a global budget by freeing
+ * the least recently parked or used ones first.
+ * ============================================================================ */
+class LOD_Mesh_Cache {
+public:
+    bool    Swap_In     (
+        const sector_loc_t& sector,
+        const chunk_loc_t&  chunk_loc,
+        Chunk&              chunk,
+        uint64_t            key,
+        mesh_format_t       format
+    );
+    void    Park        (
+        const sector_loc_t& sector,
+        const chunk_loc_t&  chunk_loc,
+        Chunk&              chunk
+    );
+    int     Drop        (const sector_loc_t& sector, const chunk_loc_t& chunk_loc);
+    void    Set_Budget  (size_t bytes);
+    void    Clear       ();
+
+    const lod_cache_stats_t& Get_Stats() const;
+
+private:
+    typedef std::list<parked_mesh_t>::iterator entry_it;
+
+    static uint64_t Chunk_Id    (const sector_loc_t& sector, const chunk_loc_t& chunk_loc);
+    static uint64_t Slot        (uint64_t chunk_id, lod_Level_t l_o_d);
+    static size_t   Mesh_Bytes  (const parked_mesh_t& parked);
+
+    void    Exchange    (Chunk& chunk, parked_mesh_t& parked);
+    void    Insert      (entry_it entry);
+    void    Erase       (entry_it entry);
+    void    Evict       ();
+
+    std::list<parked_mesh_t>                    entries;    // Most recent first
+    std::unordered_map<uint64_t, entry_it>      slots;      // Chunk and LOD to entry
+    size_t                                      budget = 0;
+    lod_cache_stats_t                           stats;
+};
+
+#endif // !LOD_MESH_CACHE_H
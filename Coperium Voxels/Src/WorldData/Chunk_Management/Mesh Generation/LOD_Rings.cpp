@@ -0,0 +1,71 @@
+#include "LOD_Rings.h"
+
+/* ============================================================================
+ * --------------------------- Push
+ * Queues a chunk until the camera has travelled `slack` further.
+ *
+ * ------ Parameters ------
+ * sector : Sector holding the chunk
+ * chunk  : Chunk location within the sector
+ * slack  : Camera travel the chunk's LOD is safe for, from Compute_LOD
+ *
+ * ------ Returns ------
+ * The travel the entry is due at, for the caller to keep with the chunk
+ * ============================================================================ */
+double LOD_Rings::Push(
+    const sector_loc_t& sector,
+    const chunk_loc_t&  chunk,
+    float               slack
+) {
+    const double due = travelled + slack;
+    queue.push({ due, sector, chunk });
+    return due;
+}
+
+/* ============================================================================
+ * --------------------------- Pop_Due
+ * Removes the next entry the camera has travelled far enough for.
+ *
+ * ------ Returns ------
+ * false once no queued entry is due
+ * ============================================================================ */
+bool LOD_Rings::Pop_Due(lod_ring_entry_t& entry) {
+    if (queue.empty() || queue.top().due > travelled) return false;
+    entry = queue.top();
+    queue.pop();
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Move_Camera
+ * Adds the straight line distance since the last call to the camera's
+ * travel. Summing steps never under counts how far any chunk's distance to
+ * the camera can have changed.
+ * ============================================================================ */
+void LOD_Rings::Move_Camera(const glm::vec3& camera_pos) {
+    if (has_camera) travelled += glm::length(camera_pos - last_camera);
+    last_camera = camera_pos;
+    has_camera  = true;
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every queued entry and forgets the camera.
+ * ============================================================================ */
+void LOD_Rings::Clear() {
+    queue       = {};
+    travelled   = 0.0;
+    has_camera  = false;
+}
+
+bool LOD_Rings::Empty() const {
+    return queue.empty();
+}
+
+size_t LOD_Rings::Size() const {
+    return queue.size();
+}
+
+double LOD_Rings::Travelled() const {
+    return travelled;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#ifndef LOD_RINGS_H
+#define LOD_RINGS_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <queue>
+#include <vector>
+#include <functional>
+#include <GLM/glm.hpp>
+
+#include "../../CommonWD.h"
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: lod_ring_entry_t                         //
+//----------------------------------------------------------------------------//
+typedef struct lod_ring_entry_t {
+    double          due;        // Camera travel at which the LOD must be checked
+    sector_loc_t    sector;
+    chunk_loc_t     chunk;
+
+    bool operator>(const lod_ring_entry_t& other) const {
+        return due > other.due;
+    }
+} lod_ring_entry_t;
+
+//----------------------------------------------------------------------------//
+//                             CLASS: LOD_Rings                               //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Tracks when each chunk's LOD could next change as the camera moves.
+ *
+ * When a chunk's LOD is computed, Compute_LOD also reports its slack: how far
+ * the camera can move before the chunk could leave its distance ring (band
+ * plus hysteresis margins). A chunk's distance to the camera can change by at
+ * most the distance the camera travels, so the chunk is queued until the
+ * camera's total travel passes the travel at evaluation plus that slack.
+ *
+ * Each update only pops the chunks that are due, so the cost follows how far
+ * the camera moved and how many chunks sit near a ring edge, not the size of
+ * the world. Like the remesh queue it only stores locations; chunks that were
+ * unloaded or re-queued since are skipped by the caller.
+ * ============================================================================ */
+class LOD_Rings {
+public:
+    double  Push        (
+        const sector_loc_t& sector,
+        const chunk_loc_t&  chunk,
+        float               slack
+    );
+    bool    Pop_Due     (lod_ring_entry_t& entry);
+    void    Move_Camera (const glm::vec3& camera_pos);
+    void    Clear       ();
+    bool    Empty       () const;
+    size_t  Size        () const;
+    double  Travelled   () const;
+
+private:
+    std::priority_queue<
+        lod_ring_entry_t,
+        std::vector<lod_ring_entry_t>,
+        std::greater<lod_ring_entry_t>
+    > queue;
+
+    double      travelled   = 0.0;      // Total camera travel
+    glm::vec3   last_camera = glm::vec3(0.0f);
+    bool        has_camera  = false;
+};
+
+#endif // !LOD_RINGS_H
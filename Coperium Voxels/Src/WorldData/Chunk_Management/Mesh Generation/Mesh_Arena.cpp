@@ -0,0 +1,643 @@
+#include <GLAD/glad.h>
+#include "Mesh_Arena.h"
+
+#include <algorithm>
+
+static_assert(NUM_SECTIONS <= 4, "Section_Key keeps 2 bits for the section and one for Back_Key");
+
+//----------------------------------------------------------------------------//
+//                              Arena_Allocator                               //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * --------------------------- Reset
+ * Forgets every block and makes the whole capacity one free block.
+ * ============================================================================ */
+void Arena_Allocator::Reset(uint32_t capacity) {
+    free_blocks.clear();
+    used_blocks.clear();
+    this->capacity = capacity;
+    used           = 0;
+    if (capacity > 0) free_blocks[0] = capacity;
+}
+
+/* ============================================================================
+ * --------------------------- Grow
+ * Adds space to the end, merged with a free block already ending there.
+ * ============================================================================ */
+void Arena_Allocator::Grow(uint32_t capacity) {
+    if (capacity <= this->capacity) return;
+
+    uint32_t start = this->capacity;
+    if (!free_blocks.empty()) {
+        auto last = std::prev(free_blocks.end());
+        if (last->first + last->second == this->capacity) {
+            start = last->first;
+            free_blocks.erase(last);
+        }
+    }
+    free_blocks[start] = capacity - start;
+    this->capacity     = capacity;
+}
+
+/* ============================================================================
+ * --------------------------- Allocate
+ * Takes `size` units from the smallest free block that holds them.
+ *
+ * ------ Parameters ------
+ * size   : Units wanted (0 is refused)
+ * offset : Receives where they start
+ *
+ * ------ Returns ------
+ * false if no free block is large enough
+ * ============================================================================ */
+bool Arena_Allocator::Allocate(uint32_t size, uint32_t& offset) {
+    if (size == 0) return false;
+
+    auto best = free_blocks.end();
+    for (auto it = free_blocks.begin(); it != free_blocks.end(); ++it) {
+        if (it->second < size) continue;
+        if (best == free_blocks.end() || it->second < best->second) best = it;
+        if (best->second == size) break;
+    }
+    if (best == free_blocks.end()) return false;
+
+    offset = best->first;
+    const uint32_t left = best->second - size;
+    free_blocks.erase(best);
+    if (left > 0) free_blocks[offset + size] = left;
+
+    used_blocks[offset] = size;
+    used += size;
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Free
+ * Returns a block, merging it with the free blocks either side of it.
+ * Offsets that were never allocated are ignored.
+ * ============================================================================ */
+void Arena_Allocator::Free(uint32_t offset) {
+    auto block = used_blocks.find(offset);
+    if (block == used_blocks.end()) return;
+
+    uint32_t start = offset;
+    uint32_t size  = block->second;
+    used -= size;
+    used_blocks.erase(block);
+
+    auto next = free_blocks.lower_bound(start);
+    if (next != free_blocks.end() && next->first == start + size) {
+        size += next->second;
+        next  = free_blocks.erase(next);
+    }
+    if (next != free_blocks.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == start) {
+            start  = prev->first;
+            size  += prev->second;
+            free_blocks.erase(prev);
+        }
+    }
+    free_blocks[start] = size;
+}
+
+/* ============================================================================
+ * --------------------------- Defragment
+ * Packs every live block down to offset 0, in their current order, leaving
+ * one free block at the end.
+ *
+ * ------ Parameters ------
+ * moves : Receives every live block's old and new offset (also the ones
+ *         that stay put), in ascending order of both
+ * ============================================================================ */
+void Arena_Allocator::Defragment(std::vector<arena_move_t>& moves) {
+    moves.clear();
+    moves.reserve(used_blocks.size());
+
+    uint32_t cursor = 0;
+    for (const auto& [offset, size] : used_blocks) {
+        moves.push_back({ offset, cursor, size });
+        cursor += size;
+    }
+
+    used_blocks.clear();
+    for (const arena_move_t& move : moves) used_blocks[move.to] = move.size;
+
+    free_blocks.clear();
+    if (cursor < capacity) free_blocks[cursor] = capacity - cursor;
+}
+
+uint32_t Arena_Allocator::Get_Capacity() const {
+    return capacity;
+}
+
+uint32_t Arena_Allocator::Get_Used() const {
+    return used;
+}
+
+uint32_t Arena_Allocator::Get_Largest_Free() const {
+    uint32_t largest = 0;
+    for (const auto& block : free_blocks) largest = std::max(largest, block.second);
+    return largest;
+}
+
+int Arena_Allocator::Get_Free_Blocks() const {
+    return static_cast<int>(free_blocks.size());
+}
+
+//----------------------------------------------------------------------------//
+//                                 Mesh_Arena                                 //
+//----------------------------------------------------------------------------//
+Mesh_Arena::~Mesh_Arena() {
+    Clear();
+}
+
+/* ============================================================================
+ * --------------------------- Is_Supported
+ * Base instances in draws need GL 4.2. Multi-draw indirect needs 4.3;
+ * without it Draw issues the same commands one call each.
+ * ============================================================================ */
+bool Mesh_Arena::Is_Supported() {
+    return GLAD_GL_VERSION_4_2 != 0;
+}
+
+/* ============================================================================
+ * --------------------------- Chunk_Key / Section_Key / Back_Key
+ * Pack a chunk's location into one map key, then add the section, then
+ * whether it is the section's back mesh (still being built).
+ * ============================================================================ */
+uint64_t Mesh_Arena::Chunk_Key(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    return (static_cast<uint64_t>(sector.location) << 32) |
+           (static_cast<uint64_t>(chunk.location)  <<  3);
+}
+
+uint64_t Mesh_Arena::Section_Key(uint64_t chunk_key, int section) {
+    return chunk_key | static_cast<uint64_t>(section);
+}
+
+uint64_t Mesh_Arena::Back_Key(uint64_t section_key) {
+    return section_key | 4u;
+}
+
+/* ============================================================================
+ * --------------------------- Upload_Section
+ * Replaces a section's faces with newly built ones, written straight into
+ * the arena. The old faces are freed first, even when the new ones are
+ * not placed. A section in another format than the arena holds drops
+ * everything in it first.
+ *
+ * ------ Parameters ------
+ * key       : Section_Key of the section
+ * format    : Layout of the data
+ * data      : The faces, grouped by direction as Upload_Chunk_Mesh does
+ * num_faces : Faces in data (0 only frees the section)
+ *
+ * ------ Returns ------
+ * false if nothing was placed; upload it into the section's own mesh
+ * ============================================================================ */
+bool Mesh_Arena::Upload_Section(
+    uint64_t                key,
+    mesh_format_t           format,
+    const void*             data,
+    int                     num_faces
+) {
+    if (format != this->format) {
+        Clear();
+        this->format = format;
+    }
+    Free_Section(key);
+    if (num_faces <= 0) return false;
+
+    const uint32_t faces = static_cast<uint32_t>(num_faces);
+    uint32_t       first = 0;
+    if (!Allocate_Faces(faces, first)) {
+        ++missed;
+        return false;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, first * Face_Bytes(), faces * Face_Bytes(), data);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    entries[key] = { first, faces };
+    ++uploaded;
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Write_Faces
+ * Overwrites some of a section's faces in place, for recolour patches.
+ *
+ * ------ Parameters ------
+ * key       : Section_Key of the section
+ * face      : First face to write, counted from the start of the section
+ * data      : The new faces, in the arena's format
+ * num_faces : Faces in data
+ *
+ * ------ Returns ------
+ * false if the arena does not hold the section (or the faces run past it)
+ * ============================================================================ */
+bool Mesh_Arena::Write_Faces(
+    uint64_t                key,
+    uint32_t                face,
+    const void*             data,
+    int                     num_faces
+) {
+    auto it = entries.find(key);
+    if (it == entries.end() || num_faces <= 0 ||
+        face + static_cast<uint32_t>(num_faces) > it->second.num_faces) return false;
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferSubData(
+        GL_ARRAY_BUFFER,
+        (it->second.first_face + face) * Face_Bytes(), num_faces * Face_Bytes(), data
+    );
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Free_Section
+ * Frees a section's faces. Sections the arena does not hold are ignored.
+ * ============================================================================ */
+void Mesh_Arena::Free_Section(uint64_t key) {
+    auto it = entries.find(key);
+    if (it == entries.end()) return;
+
+    allocator.Free(it->second.first_face);
+    entries.erase(it);
+}
+
+/* ============================================================================
+ * --------------------------- Promote_Section
+ * Makes a built back section the one drawn: the section's old faces are
+ * freed and the back faces take its key. Nothing moves in the buffer. If
+ * the back section was not placed in the arena the key is left empty.
+ *
+ * ------ Parameters ------
+ * back_key : Back_Key the section was built under
+ * key      : Section_Key it is drawn under
+ * ============================================================================ */
+void Mesh_Arena::Promote_Section(uint64_t back_key, uint64_t key) {
+    Free_Section(key);
+
+    auto it = entries.find(back_key);
+    if (it == entries.end()) return;
+
+    entries[key] = it->second;
+    entries.erase(it);
+}
+
+/* ============================================================================
+ * --------------------------- Find_Section
+ * Looks up where a section starts in the arena.
+ *
+ * ------ Returns ------
+ * false if the arena does not hold it; draw it from its own mesh
+ * ============================================================================ */
+bool Mesh_Arena::Find_Section(uint64_t key, uint32_t& first_face) const {
+    auto it = entries.find(key);
+    if (it == entries.end()) return false;
+
+    first_face = it->second.first_face;
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Begin_Frame
+ * Starts a frame's draw list.
+ *
+ * ------ Parameters ------
+ * chunk_offsets : The Chunk_Offsets buffer the commands index
+ * ============================================================================ */
+void Mesh_Arena::Begin_Frame(GLuint chunk_offsets) {
+    offset_buffer = chunk_offsets;
+    commands     .clear();
+    face_commands.clear();
+}
+
+/* ============================================================================
+ * --------------------------- Add_Section
+ * Adds the commands for one section the arena holds to this frame's draw
+ * list, in the arena's format.
+ *
+ * ------ Returns ------
+ * The number of faces the commands draw
+ * ============================================================================ */
+int Mesh_Arena::Add_Section(
+    uint32_t                first_face,
+    int                     num_faces,
+    const face_ranges_t&    ranges,
+    cube_faces_t            faces,
+    const int*              order,
+    GLuint                  draw
+) {
+    if (format == mesh_format_t::PACKED_FACE) {
+        return Append_Face_Commands(first_face, num_faces, ranges, faces, order, draw, face_commands);
+    }
+    return Append_Section_Commands(first_face, num_faces, ranges, faces, order, draw, commands);
+}
+
+/* ============================================================================
+ * --------------------------- Append_Section_Commands
+ * Turns the face runs of a PACKED_VERTEX section (Face_Runs) into indirect
+ * commands over the shared quad index buffer. No GL is touched.
+ *
+ * ------ Parameters ------
+ * first_face : Where the section starts in the arena
+ * num_faces  : Faces in the section
+ * ranges     : Where each direction sits in the section
+ * faces      : The face directions to draw
+ * order      : Optional direction order, buffer order when null
+ * draw       : The chunk's index in this frame's Chunk_Offsets
+ * commands   : Receives the commands
+ *
+ * ------ Returns ------
+ * The number of faces the commands draw
+ * ============================================================================ */
+int Mesh_Arena::Append_Section_Commands(
+    uint32_t                first_face,
+    int                     num_faces,
+    const face_ranges_t&    ranges,
+    cube_faces_t            faces,
+    const int*              order,
+    GLuint                  draw,
+    std::vector<draw_elements_command_t>& commands
+) {
+    face_run_t runs[NUM_FACES];
+    const int  num_runs = Face_Runs(ranges, num_faces, faces, order, runs);
+
+    int drawn = 0;
+    for (int r = 0; r < num_runs; ++r) {
+        draw_elements_command_t command;
+        command.count         = static_cast<GLuint>(runs[r].count * FACE_INDEX_SIZE);
+        command.first_index   = static_cast<GLuint>(runs[r].first * FACE_INDEX_SIZE);
+        command.base_vertex   = static_cast<GLint >(first_face * Coil::Quad_Index_Buffer::VERTICES_PER_QUAD);
+        command.base_instance = draw;
+        commands.push_back(command);
+        drawn += runs[r].count;
+    }
+    return drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Append_Face_Commands
+ * The PACKED_FACE version of Append_Section_Commands: one instanced
+ * command per run, each face record one instance.
+ * ============================================================================ */
+int Mesh_Arena::Append_Face_Commands(
+    uint32_t                first_face,
+    int                     num_faces,
+    const face_ranges_t&    ranges,
+    cube_faces_t            faces,
+    const int*              order,
+    GLuint                  draw,
+    std::vector<draw_arrays_command_t>& commands
+) {
+    face_run_t runs[NUM_FACES];
+    const int  num_runs = Face_Runs(ranges, num_faces, faces, order, runs);
+
+    int drawn = 0;
+    for (int r = 0; r < num_runs; ++r) {
+        draw_arrays_command_t command;
+        command.instance_count = static_cast<GLuint>(runs[r].count);
+        command.first          = draw * CFD::VERTICES_PER_FACE;
+        command.base_instance  = first_face + static_cast<GLuint>(runs[r].first);
+        commands.push_back(command);
+        drawn += runs[r].count;
+    }
+    return drawn;
+}
+
+/* ============================================================================
+ * --------------------------- Draw
+ * Uploads this frame's commands and draws them, with one multi-draw
+ * indirect call where GL 4.3 is there. The chunk offsets must already be
+ * uploaded (and bound as a texture for PACKED_FACE) and the bound shader's
+ * vertex_offset at 0.
+ *
+ * ------ Parameters ------
+ * quad_ebo : The shared quad index buffer, reserved for the largest
+ *            section uploaded (PACKED_VERTEX)
+ *
+ * ------ Returns ------
+ * The number of commands drawn
+ * ============================================================================ */
+int Mesh_Arena::Draw(GLuint quad_ebo) {
+    const bool   face_format = format == mesh_format_t::PACKED_FACE;
+    const size_t count       = face_format ? face_commands.size() : commands.size();
+
+    stats.commands          = static_cast<int>(count);
+    stats.sections          = static_cast<int>(entries.size());
+    stats.sections_uploaded = uploaded;
+    stats.sections_missed   = missed;
+    stats.capacity_faces    = allocator.Get_Capacity();
+    stats.used_faces        = allocator.Get_Used();
+    stats.largest_free      = allocator.Get_Largest_Free();
+    stats.free_blocks       = allocator.Get_Free_Blocks();
+    uploaded = missed = 0;
+    if (count == 0) return 0;
+
+    glBindVertexArray(vao);
+    if (!face_format && bound_ebo != quad_ebo) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quad_ebo);
+        bound_ebo = quad_ebo;
+    }
+    if (!face_format && bound_offsets != offset_buffer) {
+        glBindBuffer(GL_ARRAY_BUFFER, offset_buffer);
+        glEnableVertexAttribArray(CHUNK_OFFSET_ATTRIB);
+        glVertexAttribPointer(CHUNK_OFFSET_ATTRIB, 3, GL_FLOAT, GL_FALSE, CHUNK_OFFSET_STRIDE, nullptr);
+        glVertexAttribDivisor(CHUNK_OFFSET_ATTRIB, 1);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        bound_offsets = offset_buffer;
+    }
+
+    if (GLAD_GL_VERSION_4_3) {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_buffer);
+        if (face_format) {
+            glBufferData(
+                GL_DRAW_INDIRECT_BUFFER,
+                count * sizeof(draw_arrays_command_t), face_commands.data(), GL_STREAM_DRAW
+            );
+            glMultiDrawArraysIndirect(GL_TRIANGLES, nullptr, static_cast<GLsizei>(count), 0);
+        }
+        else {
+            glBufferData(
+                GL_DRAW_INDIRECT_BUFFER,
+                count * sizeof(draw_elements_command_t), commands.data(), GL_STREAM_DRAW
+            );
+            glMultiDrawElementsIndirect(
+                GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count), 0
+            );
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    else if (face_format) {
+        for (const draw_arrays_command_t& command : face_commands) {
+            glDrawArraysInstancedBaseInstance(
+                GL_TRIANGLES, static_cast<GLint>(command.first), static_cast<GLsizei>(command.count),
+                static_cast<GLsizei>(command.instance_count), command.base_instance
+            );
+        }
+    }
+    else {
+        for (const draw_elements_command_t& command : commands) {
+            glDrawElementsInstancedBaseVertexBaseInstance(
+                GL_TRIANGLES, static_cast<GLsizei>(command.count), GL_UNSIGNED_INT,
+                reinterpret_cast<const void*>(static_cast<uintptr_t>(command.first_index) * sizeof(GLuint)),
+                1, command.base_vertex, command.base_instance
+            );
+        }
+    }
+
+    glBindVertexArray(0);
+    return static_cast<int>(count);
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every section and the GL objects. They are made again when the
+ * next section is uploaded.
+ * ============================================================================ */
+void Mesh_Arena::Clear() {
+    if (vao)             glDeleteVertexArrays(1, &vao);
+    if (vbo)             glDeleteBuffers(1, &vbo);
+    if (indirect_buffer) glDeleteBuffers(1, &indirect_buffer);
+    vao = vbo = indirect_buffer = bound_ebo = bound_offsets = 0;
+
+    allocator.Reset(0);
+    entries      .clear();
+    commands     .clear();
+    face_commands.clear();
+}
+
+const mesh_arena_stats_t& Mesh_Arena::Get_Stats() const {
+    return stats;
+}
+
+/* ============================================================================
+ * --------------------------- Allocate_Faces
+ * Finds room for a section, rebuilding the buffer packed (and grown when
+ * it would be more than three quarters full) if no gap is big enough.
+ * ============================================================================ */
+bool Mesh_Arena::Allocate_Faces(uint32_t num_faces, uint32_t& first_face) {
+    if (!vao) Create_Buffers();
+    if (allocator.Allocate(num_faces, first_face)) return true;
+
+    const uint64_t needed = static_cast<uint64_t>(allocator.Get_Used()) + num_faces;
+    if (needed > MESH_ARENA_MAX_FACES) return false;
+
+    uint32_t capacity = allocator.Get_Capacity();
+    while (capacity < needed + needed / 4 && capacity < MESH_ARENA_MAX_FACES) {
+        capacity = std::min(capacity * 2, MESH_ARENA_MAX_FACES);
+    }
+
+    Rebuild_Buffer(capacity);
+    return allocator.Allocate(num_faces, first_face);
+}
+
+/* ============================================================================
+ * --------------------------- Rebuild_Buffer
+ * Moves every section into a new buffer of `capacity` faces, packed from
+ * the start, and points the entries at their new places. Blocks that stay
+ * next to each other are copied with one call. Only called while uploading,
+ * never between Begin_Frame and Draw, so no command is left pointing at an
+ * old place.
+ * ============================================================================ */
+void Mesh_Arena::Rebuild_Buffer(uint32_t capacity) {
+    allocator.Defragment(move_scratch);
+    if (capacity > allocator.Get_Capacity()) {
+        allocator.Grow(capacity);
+        ++stats.grows;
+    }
+    ++stats.defragments;
+
+    GLuint new_vbo = 0;
+    glGenBuffers(1, &new_vbo);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, new_vbo);
+    glBufferData(GL_COPY_WRITE_BUFFER, allocator.Get_Capacity() * Face_Bytes(), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_COPY_READ_BUFFER, vbo);
+
+    for (size_t i = 0; i < move_scratch.size();) {
+        arena_move_t run = move_scratch[i++];
+        while (i < move_scratch.size() &&
+               move_scratch[i].from == run.from + run.size &&
+               move_scratch[i].to   == run.to   + run.size) {
+            run.size += move_scratch[i++].size;
+        }
+        glCopyBufferSubData(
+            GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+            run.from * Face_Bytes(), run.to * Face_Bytes(), run.size * Face_Bytes()
+        );
+    }
+    glBindBuffer(GL_COPY_READ_BUFFER , 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    glDeleteBuffers(1, &vbo);
+    vbo = new_vbo;
+
+    for (auto& [key, entry] : entries) {
+        auto move = std::lower_bound(
+            move_scratch.begin(), move_scratch.end(), entry.first_face,
+            [](const arena_move_t& m, uint32_t offset) { return m.from < offset; }
+        );
+        if (move != move_scratch.end() && move->from == entry.first_face) entry.first_face = move->to;
+    }
+
+    // The VAO keeps the buffer each attribute was set up with
+    glBindVertexArray(vao);
+    Point_Attributes();
+    glBindVertexArray(0);
+}
+
+/* ============================================================================
+ * --------------------------- Create_Buffers
+ * Makes the VAO, an arena of MESH_ARENA_MIN_FACES faces in the arena's
+ * format and the indirect command buffer. The chunk offset attribute is
+ * pointed at Chunk_Offsets by Draw.
+ * ============================================================================ */
+void Mesh_Arena::Create_Buffers() {
+    allocator.Reset(MESH_ARENA_MIN_FACES);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &indirect_buffer);
+
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, MESH_ARENA_MIN_FACES * Face_Bytes(), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(vao);
+    Point_Attributes();
+    glBindVertexArray(0);
+}
+
+/* ============================================================================
+ * --------------------------- Point_Attributes
+ * Points the bound VAO's face attributes at the arena buffer, laid out
+ * like a chunk mesh of the arena's format: 3 packed floats per vertex for
+ * PACKED_VERTEX, one uvec2 record per instance for PACKED_FACE.
+ * ============================================================================ */
+void Mesh_Arena::Point_Attributes() {
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    if (format == mesh_format_t::PACKED_FACE) {
+        glEnableVertexAttribArray(0);
+        glVertexAttribIPointer(0, CFD::WORDS_PER_FACE, GL_UNSIGNED_INT, CFD::WORDS_PER_FACE * sizeof(GLuint), nullptr);
+        glVertexAttribDivisor(0, 1);
+    }
+    else {
+        for (GLuint index = 0; index < FACE_NUM_ELEMENTS; ++index) {
+            glEnableVertexAttribArray(index);
+            glVertexAttribPointer(
+                index, 1, GL_FLOAT, GL_FALSE,
+                FACE_NUM_ELEMENTS * sizeof(GLfloat),
+                reinterpret_cast<const void*>(static_cast<uintptr_t>(index) * sizeof(GLfloat))
+            );
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+GLsizeiptr Mesh_Arena::Face_Bytes() const {
+    return static_cast<GLsizeiptr>(Mesh_Bytes_Per_Face(format));
+}
@@ -0,0 +1,236 @@
+#pragma once
+#ifndef MESH_ARENA_H
+#define MESH_ARENA_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <GLM/glm.hpp>
+
+#include "Chunk_Mesh.h"
+#include "Chunk_Offsets.h"
+#include "Face_Ranges.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr uint32_t MESH_ARENA_MIN_FACES     = 1u << 16;    // First buffer size (3 MB of PACKED_VERTEX)
+constexpr uint32_t MESH_ARENA_MAX_FACES     = 1u << 21;    // Largest it may grow to (96 MB of PACKED_VERTEX)
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: arena_move_t                            //
+//----------------------------------------------------------------------------//
+typedef struct arena_move_t {
+    uint32_t from = 0;              // Old offset of the block
+    uint32_t to   = 0;              // New offset of the block
+    uint32_t size = 0;
+} arena_move_t;
+
+//----------------------------------------------------------------------------//
+//                           CLASS: Arena_Allocator                           //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Suballocator for one large buffer, in whatever unit the caller picks
+ * (the mesh arena uses faces). Knows nothing about GL, so it is checked
+ * headlessly.
+ *
+ * Allocate picks the smallest free block the request fits in, and Free
+ * merges a block with free neighbours, so the free list never holds two
+ * adjacent blocks. Defragment packs every live block down to offset 0 and
+ * reports where each one went; the caller moves the data.
+ * ============================================================================ */
+class Arena_Allocator {
+public:
+    void        Reset       (uint32_t capacity);
+    void        Grow        (uint32_t capacity);
+    bool        Allocate    (uint32_t size, uint32_t& offset);
+    void        Free        (uint32_t offset);
+    void        Defragment  (std::vector<arena_move_t>& moves);
+
+    uint32_t    Get_Capacity    () const;
+    uint32_t    Get_Used        () const;
+    uint32_t    Get_Largest_Free() const;
+    int         Get_Free_Blocks () const;
+
+private:
+    std::map<uint32_t, uint32_t>    free_blocks;    // Offset -> size
+    std::map<uint32_t, uint32_t>    used_blocks;    // Offset -> size
+    uint32_t                        capacity = 0;
+    uint32_t                        used     = 0;
+};
+
+//----------------------------------------------------------------------------//
+//                       STRUCT: draw_elements_command_t                      //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One draw, laid out as GL's DrawElementsIndirectCommand so an array of
+ * them can be uploaded to GL_DRAW_INDIRECT_BUFFER as is.
+ * ============================================================================ */
+typedef struct draw_elements_command_t {
+    GLuint  count           = 0;    // Indices to draw
+    GLuint  instance_count  = 1;
+    GLuint  first_index     = 0;    // Into the shared quad index buffer
+    GLint   base_vertex     = 0;    // Where the section starts in the arena
+    GLuint  base_instance   = 0;    // Picks the draw's chunk offset
+} draw_elements_command_t;
+
+static_assert(sizeof(draw_elements_command_t) == 5 * sizeof(GLuint),
+              "draw_elements_command_t must match DrawElementsIndirectCommand");
+
+//----------------------------------------------------------------------------//
+//                        STRUCT: draw_arrays_command_t                       //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One PACKED_FACE draw, laid out as GL's DrawArraysIndirectCommand. Each
+ * instance is one face record; `first` is what face.vert divides
+ * gl_VertexID by to find the chunk's offset.
+ * ============================================================================ */
+typedef struct draw_arrays_command_t {
+    GLuint  count           = CFD::VERTICES_PER_FACE;
+    GLuint  instance_count  = 0;    // Faces to draw
+    GLuint  first           = 0;    // 6 * the chunk's index in Chunk_Offsets
+    GLuint  base_instance   = 0;    // First face record in the arena
+} draw_arrays_command_t;
+
+static_assert(sizeof(draw_arrays_command_t) == 4 * sizeof(GLuint),
+              "draw_arrays_command_t must match DrawArraysIndirectCommand");
+
+//----------------------------------------------------------------------------//
+//                          STRUCT: mesh_arena_stats_t                        //
+//----------------------------------------------------------------------------//
+typedef struct mesh_arena_stats_t {
+    uint32_t    capacity_faces  = 0;    // Size of the arena buffer
+    uint32_t    used_faces      = 0;    // Faces held for resident sections
+    uint32_t    largest_free    = 0;    // Biggest section that fits without a defragment
+    int         free_blocks     = 0;    // Gaps between resident sections
+    int         sections        = 0;    // Sections held in the arena
+    int         sections_uploaded = 0;  // Uploaded since the last Draw
+    int         sections_missed = 0;    // Did not fit since the last Draw, given their own mesh
+    int         commands        = 0;    // Draw commands in this frame's multi-draw
+    int         defragments     = 0;    // Buffer rebuilds since the arena was made
+    int         grows           = 0;    // Of those, ones that grew it
+} mesh_arena_stats_t;
+
+//----------------------------------------------------------------------------//
+//                              CLASS: Mesh_Arena                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Chunk sections held in one buffer instead of a Basic_Mesh each, and
+ * drawn with one multi-draw indirect call.
+ *
+ * Upload_Chunk_Mesh writes a built section straight into its place here
+ * (glBufferSubData) and leaves the chunk's own mesh empty; recolour
+ * patches are written here too. A section being rebuilt goes in under its
+ * Back_Key, so the old faces are drawn until the whole chunk is built and
+ * Promote_Section hands the key over. A section is freed when it is
+ * replaced or its chunk unloads. The arena holds one mesh format at a time and drops
+ * everything when sections of the other one arrive.
+ *
+ * Each frame Render adds commands for the runs of faces it wants (Face_Runs).
+ * PACKED_VERTEX commands index the shared quad index buffer with their base
+ * vertex at the section's place, and pick the chunk's offset through the
+ * per-instance attribute by base instance. PACKED_FACE commands draw one
+ * instance per face record from the section's place, and face.vert picks
+ * the offset from the first vertex as it does for chunk meshes. Either way
+ * the frame needs no uniform changes.
+ *
+ * When a section does not fit, the arena is rebuilt into a new buffer with
+ * its live sections packed together (growing it if they still would not
+ * fit). A section that still cannot be placed is left to the caller to
+ * upload into its own mesh.
+ * ============================================================================ */
+class Mesh_Arena {
+public:
+    ~Mesh_Arena();
+
+    static bool     Is_Supported    ();
+    static uint64_t Chunk_Key       (const sector_loc_t& sector, const chunk_loc_t& chunk);
+    static uint64_t Section_Key     (uint64_t chunk_key, int section);
+    static uint64_t Back_Key        (uint64_t section_key);
+
+    bool    Upload_Section  (
+        uint64_t                key,
+        mesh_format_t           format,
+        const void*             data,
+        int                     num_faces
+    );
+    bool    Write_Faces     (
+        uint64_t                key,
+        uint32_t                face,
+        const void*             data,
+        int                     num_faces
+    );
+    void    Free_Section    (uint64_t key);
+    void    Promote_Section (uint64_t back_key, uint64_t key);
+    bool    Find_Section    (uint64_t key, uint32_t& first_face) const;
+
+    void    Begin_Frame     (GLuint chunk_offsets);
+    int     Add_Section     (
+        uint32_t                first_face,
+        int                     num_faces,
+        const face_ranges_t&    ranges,
+        cube_faces_t            faces,
+        const int*              order,
+        GLuint                  draw
+    );
+    int     Draw            (GLuint quad_ebo);
+    void    Clear           ();
+
+    const mesh_arena_stats_t& Get_Stats() const;
+
+    static int  Append_Section_Commands(
+        uint32_t                first_face,
+        int                     num_faces,
+        const face_ranges_t&    ranges,
+        cube_faces_t            faces,
+        const int*              order,
+        GLuint                  draw,
+        std::vector<draw_elements_command_t>& commands
+    );
+    static int  Append_Face_Commands(
+        uint32_t                first_face,
+        int                     num_faces,
+        const face_ranges_t&    ranges,
+        cube_faces_t            faces,
+        const int*              order,
+        GLuint                  draw,
+        std::vector<draw_arrays_command_t>& commands
+    );
+
+private:
+    typedef struct arena_entry_t {
+        uint32_t    first_face  = 0;
+        uint32_t    num_faces   = 0;
+    } arena_entry_t;
+
+    bool    Allocate_Faces  (uint32_t num_faces, uint32_t& first_face);
+    void    Rebuild_Buffer  (uint32_t capacity);
+    void    Create_Buffers  ();
+    void    Point_Attributes();
+    GLsizeiptr Face_Bytes   () const;
+
+    Arena_Allocator                         allocator;
+    std::unordered_map<uint64_t, arena_entry_t> entries;
+    std::vector<draw_elements_command_t>    commands;       // This frame's PACKED_VERTEX draws
+    std::vector<draw_arrays_command_t>      face_commands;  // This frame's PACKED_FACE draws
+    std::vector<arena_move_t>               move_scratch;   // Reused by Rebuild_Buffer
+    mesh_format_t                           format      = mesh_format_t::PACKED_VERTEX;
+
+    GLuint  vao             = 0;
+    GLuint  vbo             = 0;
+    GLuint  offset_buffer   = 0;    // Chunk_Offsets buffer, not owned
+    GLuint  indirect_buffer = 0;
+    GLuint  bound_ebo       = 0;    // Quad index buffer the VAO points at
+    GLuint  bound_offsets   = 0;    // Chunk_Offsets buffer the VAO points at
+
+    int     uploaded        = 0;    // Counted into stats at the next Draw
+    int     missed          = 0;
+
+    mesh_arena_stats_t  stats;
+};
+
+#endif // !MESH_ARENA_H
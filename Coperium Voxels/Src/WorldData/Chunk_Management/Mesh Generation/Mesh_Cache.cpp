@@ -0,0 +1,184 @@
+#include "Mesh_Cache.h"
+
+#include <fstream>
+#include <iostream>
+
+/* ============================================================================
+ * --------------------------- Hash_Step
+ * Folds one 64-bit value into an FNV-1a style running hash.
+ * ============================================================================ */
+static inline uint64_t Hash_Step(uint64_t hash, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        hash ^= (value >> (i * 8)) & 0xFF;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/* ============================================================================
+ * --------------------------- Hash_Border
+ * Hashes the solidity of one plane of a neighbouring chunk, the only part of
+ * it the mesher looks at. Colours of neighbours never affect this chunk.
+ *
+ * ------ Parameters ------
+ * hash      : Running hash
+ * neighbour : The neighbouring chunk
+ * axis      : 0 = x, 1 = y, 2 = z; the axis the plane is perpendicular to
+ * plane     : Coordinate of the plane along that axis
+ * ============================================================================ */
+static uint64_t Hash_Border(uint64_t hash, const Chunk& neighbour, int axis, int plane) {
+    const int size_u = axis == 0 ? CHUNK_SIZE_Y : CHUNK_SIZE_X;
+    const int size_v = axis == 2 ? CHUNK_SIZE_Y : CHUNK_SIZE_Z;
+
+    uint64_t bits  = 0;
+    int      count = 0;
+    for (int u = 0; u < size_u; ++u) {
+        for (int v = 0; v < size_v; ++v) {
+            const glm::ivec3 pos =
+                axis == 0 ? glm::ivec3(plane, u, v) :
+                axis == 1 ? glm::ivec3(u, plane, v) :
+                            glm::ivec3(u, v, plane);
+
+            bits |= static_cast<uint64_t>(neighbour.Get_Voxel(pos)->IsAir()) << count;
+            if (++count == 64) {
+                hash  = Hash_Step(hash, bits);
+                bits  = 0;
+                count = 0;
+            }
+        }
+    }
+    return count ? Hash_Step(hash, bits) : hash;
+}
+
+/* ============================================================================
+ * --------------------------- Mesh_Cache_Key
+ * Hashes every input the mesher reads for a chunk: its own voxels, the
+ * facing border plane and LOD of each neighbour, and the mesh format.
+ *
+ * ------ Parameters ------
+ * c_neighbours : The chunk's neighbours, as passed to the mesher
+ * chunk        : The chunk itself
+ * format       : The mesh format that will be built
+ * voxel_hash   : Optional, set to the hash of the chunk's own voxels
+ *
+ * ------ Returns ------
+ * The cache key
+ * ============================================================================ */
+uint64_t Mesh_Cache_Key(
+    const neighbouring_chunks_t&    c_neighbours,
+    const Chunk&                    chunk,
+    mesh_format_t                   format,
+    uint64_t*                       voxel_hash
+) {
+    const uint64_t voxels = chunk.Hash_Voxels();
+    if (voxel_hash) *voxel_hash = voxels;
+
+    uint64_t hash = 0xCBF29CE484222325ull;
+    hash = Hash_Step(hash, MESH_CACHE_VERSION);
+    hash = Hash_Step(hash, static_cast<uint64_t>(format));
+    hash = Hash_Step(hash, voxels);
+
+    const struct { n_chunk_t side; int axis; int plane; } borders[NUM_NEIGHBOURS] = {
+        { LEFT_NEIGH , 0, MAX_ID_V_X }, { RIGHT_NEIGH, 0, MIN_ID_V_X },
+        { UP_NEIGH   , 1, MIN_ID_V_Y }, { DOWN_NEIGH , 1, MAX_ID_V_Y },
+        { FRONT_NEIGH, 2, MIN_ID_V_Z }, { BACK_NEIGH , 2, MAX_ID_V_Z },
+    };
+
+    for (const auto& border : borders) {
+        const Chunk* neighbour = c_neighbours.chunks[border.side][NEIGHBOR];
+        hash = Hash_Step  (hash, static_cast<uint64_t>(static_cast<int64_t>(neighbour->Get_Chunk_Data().l_o_d)));
+        hash = Hash_Border(hash, *neighbour, border.axis, border.plane);
+    }
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+//                                 FILE I/O                                   //
+//----------------------------------------------------------------------------//
+template <typename T>
+static void Write_Value(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static void Write_Array(std::ofstream& out, const std::vector<T>& values) {
+    const uint32_t count = static_cast<uint32_t>(values.size());
+    Write_Value(out, count);
+    out.write(reinterpret_cast<const char*>(values.data()), count * sizeof(T));
+}
+
+template <typename T>
+static bool Read_Value(std::ifstream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+template <typename T>
+static bool Read_Array(std::ifstream& in, std::vector<T>& values) {
+    uint32_t count = 0;
+    if (!Read_Value(in, count)) return false;
+    values.resize(count);
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(values.data()), count * sizeof(T)));
+}
+
+/* ============================================================================
+ * --------------------------- Save_Mesh_Cache_File
+ * Writes a chunk's cached mesh to disk.
+ *
+ * ------ Returns ------
+ * true if the whole file was written
+ * ============================================================================ */
+bool Save_Mesh_Cache_File(const std::filesystem::path& file, const mesh_cache_t& cache) {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Error: Could not open mesh cache for writing: " << file << std::endl;
+        return false;
+    }
+
+    Write_Value(out, MESH_CACHE_MAGIC);
+    Write_Value(out, MESH_CACHE_VERSION);
+    Write_Value(out, cache.key);
+    Write_Value(out, static_cast<int32_t>(cache.l_o_d));
+    Write_Value(out, static_cast<int32_t>(cache.format));
+
+    for (const mesh_cache_section_t& section : cache.sections) {
+        Write_Value(out, static_cast<int32_t>(section.num_faces));
+        Write_Value(out, static_cast<uint8_t>(section.has_face_slots));
+        Write_Array(out, section.vertex_mesh);
+        Write_Array(out, section.face_mesh);
+        Write_Array(out, section.face_slots);
+    }
+    return static_cast<bool>(out);
+}
+
+/* ============================================================================
+ * --------------------------- Load_Mesh_Cache_File
+ * Reads a cached mesh. The caller compares the key, LOD and format.
+ *
+ * ------ Returns ------
+ * false if the file is missing, truncated or from another cache version
+ * ============================================================================ */
+bool Load_Mesh_Cache_File(const std::filesystem::path& file, mesh_cache_t& cache) {
+    std::ifstream in(file, std::ios::binary);
+    if (!in) return false;
+
+    uint32_t magic = 0, version = 0;
+    int32_t  l_o_d = 0, format  = 0;
+    if (!Read_Value(in, magic) || magic   != MESH_CACHE_MAGIC  ) return false;
+    if (!Read_Value(in, version) || version != MESH_CACHE_VERSION) return false;
+    if (!Read_Value(in, cache.key) || !Read_Value(in, l_o_d) || !Read_Value(in, format)) return false;
+
+    cache.l_o_d  = static_cast<lod_Level_t  >(l_o_d );
+    cache.format = static_cast<mesh_format_t>(format);
+
+    for (mesh_cache_section_t& section : cache.sections) {
+        int32_t num_faces = 0;
+        uint8_t has_slots = 0;
+        if (!Read_Value(in, num_faces) || !Read_Value(in, has_slots)) return false;
+        if (!Read_Array(in, section.vertex_mesh)) return false;
+        if (!Read_Array(in, section.face_mesh  )) return false;
+        if (!Read_Array(in, section.face_slots )) return false;
+        section.num_faces      = num_faces;
+        section.has_face_slots = has_slots != 0;
+    }
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <GLFW/glfw3.h>
+
+#include "Chunk_Mesh.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr uint32_t  MESH_CACHE_MAGIC    = 0x434D5643;   // "CVMC"
+constexpr uint32_t  MESH_CACHE_VERSION  = 1;            // Bump when the mesh layout changes
+static const std::string MESH_CACHE_EXT = ".mesh";     // Next to the chunk's .dat save
+
+//----------------------------------------------------------------------------//
+//                       STRUCT: mesh_cache_section_t                         //
+//----------------------------------------------------------------------------//
+typedef struct mesh_cache_section_t {
+    int                     num_faces       = 0;
+    std::vector<GLfloat>    vertex_mesh;                // PACKED_VERTEX data
+    std::vector<GLuint >    face_mesh;                  // PACKED_FACE data
+    face_slots_t            face_slots;
+    bool                    has_face_slots  = false;
+} mesh_cache_section_t;
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: mesh_cache_t                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Everything needed to upload a chunk's mesh without running the mesher.
+ *
+ * The key hashes every input of the mesher: the chunk's voxels, the solidity
+ * of the neighbouring border voxels, the neighbours' LODs and the format. A
+ * cached mesh is only used when the key, LOD and format all still match.
+ * ============================================================================ */
+typedef struct mesh_cache_t {
+    uint64_t                key         = 0;
+    lod_Level_t             l_o_d       = lod_Level_t::NORMAL;
+    mesh_format_t           format      = mesh_format_t::PACKED_VERTEX;
+    mesh_cache_section_t    sections[NUM_SECTIONS];
+} mesh_cache_t;
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+uint64_t Mesh_Cache_Key(
+    const neighbouring_chunks_t&    c_neighbours,
+    const Chunk&                    chunk,
+    mesh_format_t                   format,
+    uint64_t*                       voxel_hash = nullptr
+);
+
+bool Save_Mesh_Cache_File(const std::filesystem::path& file, const mesh_cache_t& cache);
+bool Load_Mesh_Cache_File(const std::filesystem::path& file, mesh_cache_t& cache);
+
+#endif // !MESH_CACHE_H
@@ -0,0 +1,101 @@
+#include "Mesh_Scratch.h"
+
+/* ============================================================================
+ * --------------------------- mesh_scratch_t Constructor
+ * Reserves the initial capacity once per thread. The mask buffer has a fixed
+ * size and is allocated here once.
+ * ============================================================================ */
+mesh_scratch_t::mesh_scratch_t() {
+    vertex_mesh.reserve(SCRATCH_INIT_VERTEX_FLOATS);
+    face_mesh  .reserve(SCRATCH_INIT_FACE_WORDS);
+    face_masks .resize (SECTION_VOXELS);
+    last_vertex_capacity = vertex_mesh.capacity();
+    last_face_capacity   = face_mesh  .capacity();
+}
+
+/* ============================================================================
+ * --------------------------- Reset
+ * Empties the buffers while keeping their capacity for the next chunk.
+ * ============================================================================ */
+void mesh_scratch_t::Reset() {
+    vertex_mesh.clear();
+    face_mesh  .clear();
+    face_slots .clear();
+    has_face_slots = false;
+}
+
+/* ============================================================================
+ * --------------------------- Record_Usage
+ * Updates the high-water marks after a chunk has been built and counts any
+ * reallocation that happened while building it.
+ * ============================================================================ */
+void mesh_scratch_t::Record_Usage() {
+    if (vertex_mesh.size() > peak_vertex_floats) peak_vertex_floats = vertex_mesh.size();
+    if (face_mesh  .size() > peak_face_words   ) peak_face_words    = face_mesh  .size();
+
+    if (vertex_mesh.capacity() != last_vertex_capacity) {
+        last_vertex_capacity = vertex_mesh.capacity();
+        ++grow_count;
+    }
+    if (face_mesh.capacity() != last_face_capacity) {
+        last_face_capacity = face_mesh.capacity();
+        ++grow_count;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Group_By_Direction
+ * Copies the built faces into the grouped buffers, sorted by direction and
+ * optionally near to far inside each direction. face_order is only filled
+ * when there is a slot map that needs it.
+ *
+ * ------ Parameters ------
+ * num_faces  : Number of faces that were built
+ * format     : Which of the two buffers holds them
+ * depth_sort : Order each direction by plane, near to far
+ * ============================================================================ */
+void mesh_scratch_t::Group_By_Direction(int num_faces, mesh_format_t format, bool depth_sort) {
+    const void* in  = nullptr;
+    void*       out = nullptr;
+    if (format == mesh_format_t::PACKED_FACE) {
+        grouped_face.resize(face_mesh.size());
+        in  = face_mesh   .data();
+        out = grouped_face.data();
+    }
+    else {
+        grouped_vertex.resize(vertex_mesh.size());
+        in  = vertex_mesh   .data();
+        out = grouped_vertex.data();
+    }
+
+    face_order.clear();
+    Group_Faces_By_Direction(
+        in, out, num_faces, format, face_ranges,
+        has_face_slots ? &face_order : nullptr, depth_sort
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Get_Peak_Bytes
+ * Returns the largest number of bytes used by a single chunk build.
+ * ============================================================================ */
+size_t mesh_scratch_t::Get_Peak_Bytes() const {
+    return peak_vertex_floats * sizeof(GLfloat) + peak_face_words * sizeof(GLuint);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Capacity_Bytes
+ * Returns the number of bytes currently held by the arena.
+ * ============================================================================ */
+size_t mesh_scratch_t::Get_Capacity_Bytes() const {
+    return vertex_mesh.capacity() * sizeof(GLfloat) + face_mesh.capacity() * sizeof(GLuint);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Mesh_Scratch
+ * Returns the calling thread's scratch arena, creating it on first use.
+ * ============================================================================ */
+mesh_scratch_t& Get_Mesh_Scratch() {
+    thread_local mesh_scratch_t scratch;
+    return scratch;
+}
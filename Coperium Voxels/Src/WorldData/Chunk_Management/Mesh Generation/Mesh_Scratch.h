@@ -0,0 +1,76 @@
+#pragma once
+#ifndef MESH_SCRATCH_H
+#define MESH_SCRATCH_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <vector>
+#include <cstddef>
+#include <GLFW/glfw3.h>
+
+#include "Face_Patch.h"
+#include "Face_Ranges.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr size_t SCRATCH_INIT_VERTEX_FLOATS = static_cast<size_t>(16) * 1024;
+constexpr size_t SCRATCH_INIT_FACE_WORDS    = static_cast<size_t>(4)  * 1024;
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: mesh_scratch_t                           //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Per-thread scratch arena used while building chunk meshes.
+ *
+ * The buffers are never freed between chunks, only reset, so their capacity
+ * settles at the largest chunk seen so far and steady-state meshing does no
+ * heap allocation. Peak usage and the number of times the arena had to grow
+ * are tracked so the high-water mark can be reported.
+ *
+ * vertex_mesh is filled in the PACKED_VERTEX format, face_mesh in the
+ * PACKED_FACE (CFD record) format. The full detail mesher also records the
+ * voxel to face slot map so the section can later be patched in place.
+ * face_masks holds one visibility mask per section voxel for the two pass
+ * mesher, so the write pass does not repeat the neighbour lookups.
+ *
+ * Before upload the faces are copied into grouped_vertex / grouped_face
+ * sorted by direction, with face_ranges saying where each direction went
+ * and face_order mapping mesher order to grouped order for the slot map.
+ * ============================================================================ */
+typedef struct mesh_scratch_t {
+    std::vector<GLfloat>    vertex_mesh;
+    std::vector<GLuint >    face_mesh;
+    face_slots_t            face_slots;
+    bool                    has_face_slots  = false;    // face_slots describe this build
+    std::vector<uint8_t>    face_masks;                 // SECTION_VOXELS cube_faces_t masks
+
+    std::vector<GLfloat>    grouped_vertex;             // vertex_mesh sorted by direction
+    std::vector<GLuint >    grouped_face;               // face_mesh sorted by direction
+    std::vector<uint16_t>   face_order;                 // Grouped index of each built face
+    face_ranges_t           face_ranges;                // Where each direction was grouped to
+
+    size_t  peak_vertex_floats  = 0;    // Largest vertex float count seen
+    size_t  peak_face_words     = 0;    // Largest face record word count seen
+    size_t  grow_count          = 0;    // Times either buffer reallocated
+
+    mesh_scratch_t();
+
+    void    Reset           ();
+    void    Record_Usage    ();
+    void    Group_By_Direction(int num_faces, mesh_format_t format, bool depth_sort);
+    size_t  Get_Peak_Bytes  () const;
+    size_t  Get_Capacity_Bytes() const;
+
+private:
+    size_t  last_vertex_capacity = 0;
+    size_t  last_face_capacity   = 0;
+} mesh_scratch_t;
+
+//----------------------------------------------------------------------------//
+//                                 FUNCTIONS                                  //
+//----------------------------------------------------------------------------//
+mesh_scratch_t& Get_Mesh_Scratch();
+
+#endif // !MESH_SCRATCH_H
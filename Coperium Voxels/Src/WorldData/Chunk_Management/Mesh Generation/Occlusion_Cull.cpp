@@ -0,0 +1,369 @@
+#include "Occlusion_Cull.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <emmintrin.h>
+
+static_assert(OCCLUSION_WIDTH % 4 == 0, "Raster_Face writes rows four pixels at a time");
+
+/* ============================================================================
+ * --------------------------- Level_Width / Level_Height
+ * Size of a pyramid level in texels.
+ * ============================================================================ */
+static inline int Level_Width(int level) {
+    return std::max(1, OCCLUSION_WIDTH >> level);
+}
+static inline int Level_Height(int level) {
+    return std::max(1, OCCLUSION_HEIGHT >> level);
+}
+
+/* ============================================================================
+ * --------------------------- To_Screen
+ * Projects a world point to depth buffer pixels and NDC depth.
+ *
+ * ------ Returns ------
+ * false if the point is behind the camera or in front of the near plane
+ * ============================================================================ */
+static inline bool To_Screen(const glm::mat4& view_projection, const glm::vec3& point, glm::vec3& screen) {
+    const glm::vec4 clip = view_projection * glm::vec4(point, 1.0f);
+    if (clip.w <= 0.0f || clip.z < -clip.w) return false;
+
+    const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+    screen = glm::vec3(
+        (ndc.x * 0.5f + 0.5f) * OCCLUSION_WIDTH,
+        (ndc.y * 0.5f + 0.5f) * OCCLUSION_HEIGHT,
+        ndc.z
+    );
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Begin
+ * Starts a frame: clears the depth buffer to the far plane.
+ *
+ * ------ Parameters ------
+ * view_projection : projection * view of the camera drawing this frame
+ * camera          : Camera position, picks which occluder faces to draw
+ * ============================================================================ */
+void Occlusion_Culler::Begin(const glm::mat4& view_projection, const glm::vec3& camera) {
+    build_start           = std::chrono::steady_clock::now();
+    this->view_projection = view_projection;
+    this->camera          = camera;
+    stats                 = occlusion_stats_t();
+
+    for (int level = 0; level < OCCLUSION_LEVELS; ++level) {
+        levels[level].assign(static_cast<size_t>(Level_Width(level)) * Level_Height(level), 1.0f);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Raster_Face
+ * Rasterises one convex quad into level 0. Edge functions and NDC depth are
+ * both affine over the screen, so a pixel is fully covered when the corner
+ * lowest on every edge function is inside, and the farthest depth over it
+ * is at the corner highest on the depth plane. Faces touching the near
+ * plane are skipped; leaving an occluder out is always safe.
+ * ============================================================================ */
+void Occlusion_Culler::Raster_Face(const glm::vec3 (&corners)[4]) {
+    glm::vec3 screen[4];
+    for (int i = 0; i < 4; ++i) {
+        if (!To_Screen(view_projection, corners[i], screen[i])) return;
+    }
+
+    float area = 0.0f;
+    for (int i = 0; i < 4; ++i) {
+        const glm::vec3& a = screen[i];
+        const glm::vec3& b = screen[(i + 1) % 4];
+        area += a.x * b.y - b.x * a.y;
+    }
+    if (std::abs(area) < 1e-6f) return;
+    const float orient = area > 0.0f ? 1.0f : -1.0f;
+
+    // Inside edge i when A x + B y + C >= 0. C is moved to the pixel corner
+    // lowest on the edge, so evaluating at (x, y) tests the whole pixel.
+    float edge_a[4], edge_b[4], edge_c[4];
+    for (int i = 0; i < 4; ++i) {
+        const glm::vec3& a = screen[i];
+        const glm::vec3& b = screen[(i + 1) % 4];
+        edge_a[i] = -(b.y - a.y) * orient;
+        edge_b[i] =  (b.x - a.x) * orient;
+        edge_c[i] = -(edge_a[i] * a.x + edge_b[i] * a.y)
+                  + std::min(edge_a[i], 0.0f) + std::min(edge_b[i], 0.0f);
+    }
+
+    // depth = dx x + dy y + dz, with dz moved to the farthest pixel corner
+    const glm::vec3 normal = glm::cross(screen[1] - screen[0], screen[2] - screen[0]);
+    if (std::abs(normal.z) < 1e-9f) return;
+    const float dx = -normal.x / normal.z;
+    const float dy = -normal.y / normal.z;
+    const float dz = screen[0].z - dx * screen[0].x - dy * screen[0].y
+                   + std::max(dx, 0.0f) + std::max(dy, 0.0f);
+
+    float lo_x = FLT_MAX, lo_y = FLT_MAX, hi_x = -FLT_MAX, hi_y = -FLT_MAX;
+    for (const glm::vec3& s : screen) {
+        lo_x = std::min(lo_x, s.x);  hi_x = std::max(hi_x, s.x);
+        lo_y = std::min(lo_y, s.y);  hi_y = std::max(hi_y, s.y);
+    }
+    const int x0 = std::max(0, static_cast<int>(std::floor(lo_x)));
+    const int y0 = std::max(0, static_cast<int>(std::floor(lo_y)));
+    const int x1 = std::min(OCCLUSION_WIDTH  - 1, static_cast<int>(std::ceil(hi_x)) - 1);
+    const int y1 = std::min(OCCLUSION_HEIGHT - 1, static_cast<int>(std::ceil(hi_y)) - 1);
+
+    // Four pixels a step with SSE2 (the baseline on every target). Rows start
+    // on a multiple of 4, so lanes left of x0 or right of x1 are masked out
+    // and keep their old depth.
+    const __m128 lane    = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    const __m128 zero    = _mm_setzero_ps();
+    const __m128 first_x = _mm_set1_ps(static_cast<float>(x0));
+    const __m128 last_x  = _mm_set1_ps(static_cast<float>(x1));
+    const __m128 depth_x = _mm_set1_ps(dx);
+    const __m128 depth_c = _mm_set1_ps(dz);
+    __m128 step_x[4], offset[4];
+    for (int i = 0; i < 4; ++i) {
+        step_x[i] = _mm_set1_ps(edge_a[i]);
+        offset[i] = _mm_set1_ps(edge_c[i]);
+    }
+
+    std::vector<float>& depth = levels[0];
+    for (int y = y0; y <= y1; ++y) {
+        const float fy  = static_cast<float>(y);
+        float*      row = depth.data() + static_cast<size_t>(y) * OCCLUSION_WIDTH;
+
+        __m128 row_y[4];
+        for (int i = 0; i < 4; ++i) row_y[i] = _mm_set1_ps(edge_b[i] * fy);
+        const __m128 depth_y = _mm_set1_ps(dy * fy);
+
+        for (int x = x0 & ~3; x <= x1; x += 4) {
+            const __m128 fx = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), lane);
+
+            __m128 covered = _mm_and_ps(_mm_cmpge_ps(fx, first_x), _mm_cmple_ps(fx, last_x));
+            for (int i = 0; i < 4; ++i) {
+                const __m128 edge = _mm_add_ps(_mm_add_ps(_mm_mul_ps(step_x[i], fx), row_y[i]), offset[i]);
+                covered = _mm_and_ps(covered, _mm_cmpge_ps(edge, zero));
+            }
+
+            const __m128 z   = _mm_add_ps(_mm_add_ps(_mm_mul_ps(depth_x, fx), depth_y), depth_c);
+            const __m128 old = _mm_loadu_ps(row + x);
+            _mm_storeu_ps(row + x, _mm_or_ps(
+                _mm_and_ps   (covered, _mm_min_ps(old, z)),
+                _mm_andnot_ps(covered, old)
+            ));
+        }
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Add_Occluder
+ * Rasterises the faces of a solid box that face the camera.
+ * ============================================================================ */
+void Occlusion_Culler::Add_Occluder(const glm::vec3& box_min, const glm::vec3& box_max) {
+    ++stats.occluders;
+
+    for (int axis = 0; axis < 3; ++axis) {
+        float plane;
+        if      (camera[axis] < box_min[axis]) plane = box_min[axis];
+        else if (camera[axis] > box_max[axis]) plane = box_max[axis];
+        else continue;
+
+        const int u = (axis + 1) % 3;
+        const int v = (axis + 2) % 3;
+        glm::vec3 corners[4];
+        for (int i = 0; i < 4; ++i) {
+            corners[i][axis] = plane;
+            corners[i][u]    = (i == 1 || i == 2) ? box_max[u] : box_min[u];
+            corners[i][v]    = (i >= 2)           ? box_max[v] : box_min[v];
+        }
+        Raster_Face(corners);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Build_Pyramid
+ * Fills every level above 0 with the farthest depth of the 2 x 2 texels
+ * below it. Call once all occluders are in.
+ * ============================================================================ */
+void Occlusion_Culler::Build_Pyramid() {
+    for (int level = 1; level < OCCLUSION_LEVELS; ++level) {
+        const int width       = Level_Width (level);
+        const int height      = Level_Height(level);
+        const int below_width = Level_Width (level - 1);
+        const int below_max_y = Level_Height(level - 1) - 1;
+        const std::vector<float>& below = levels[level - 1];
+
+        for (int y = 0; y < height; ++y) {
+            const int by0 = std::min(y * 2, below_max_y);
+            const int by1 = std::min(y * 2 + 1, below_max_y);
+            for (int x = 0; x < width; ++x) {
+                const int bx0 = x * 2;
+                const int bx1 = std::min(x * 2 + 1, below_width - 1);
+                levels[level][static_cast<size_t>(y) * width + x] = std::max(
+                    std::max(below[by0 * below_width + bx0], below[by0 * below_width + bx1]),
+                    std::max(below[by1 * below_width + bx0], below[by1 * below_width + bx1])
+                );
+            }
+        }
+    }
+
+    stats.build_ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - build_start
+    ).count();
+}
+
+/* ============================================================================
+ * --------------------------- Is_Occluded
+ * Tests a box against the pyramid. Boxes reaching past the near plane or
+ * off the screen are reported visible; the frustum deals with the latter.
+ *
+ * ------ Returns ------
+ * true if every texel under the box's screen rectangle is nearer than the
+ * box's nearest point
+ * ============================================================================ */
+bool Occlusion_Culler::Is_Occluded(const glm::vec3& box_min, const glm::vec3& box_max) {
+    const auto start = std::chrono::steady_clock::now();
+    ++stats.boxes_tested;
+
+    auto test = [&]() {
+        float lo_x = FLT_MAX, lo_y = FLT_MAX, hi_x = -FLT_MAX, hi_y = -FLT_MAX;
+        float nearest = FLT_MAX;
+        for (int i = 0; i < 8; ++i) {
+            const glm::vec3 corner(
+                (i & 1) ? box_max.x : box_min.x,
+                (i & 2) ? box_max.y : box_min.y,
+                (i & 4) ? box_max.z : box_min.z
+            );
+            glm::vec3 screen;
+            if (!To_Screen(view_projection, corner, screen)) return false;
+
+            lo_x = std::min(lo_x, screen.x);  hi_x = std::max(hi_x, screen.x);
+            lo_y = std::min(lo_y, screen.y);  hi_y = std::max(hi_y, screen.y);
+            nearest = std::min(nearest, screen.z);
+        }
+
+        const int x0 = std::max(0, static_cast<int>(std::floor(lo_x)));
+        const int y0 = std::max(0, static_cast<int>(std::floor(lo_y)));
+        const int x1 = std::min(OCCLUSION_WIDTH  - 1, static_cast<int>(std::floor(hi_x)));
+        const int y1 = std::min(OCCLUSION_HEIGHT - 1, static_cast<int>(std::floor(hi_y)));
+        if (x0 > x1 || y0 > y1) return false;
+
+        int level = 0;
+        while (level < OCCLUSION_LEVELS - 1 &&
+               ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1)) {
+            ++level;
+        }
+
+        const int width = Level_Width(level);
+        const std::vector<float>& depth = levels[level];
+        for (int y = y0 >> level; y <= (y1 >> level); ++y) {
+            for (int x = x0 >> level; x <= (x1 >> level); ++x) {
+                if (depth[static_cast<size_t>(y) * width + x] >= nearest) return false;
+            }
+        }
+        return true;
+    };
+
+    const bool occluded = test();
+    if (occluded) ++stats.boxes_occluded;
+    stats.test_ms += std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+    return occluded;
+}
+
+/* ============================================================================
+ * --------------------------- Get_Depth
+ * One texel of a pyramid level, for checks and debugging.
+ * ============================================================================ */
+float Occlusion_Culler::Get_Depth(int x, int y, int level) const {
+    return levels[level][static_cast<size_t>(y) * Level_Width(level) + x];
+}
+
+/* ============================================================================
+ * --------------------------- Get_Stats
+ * Returns this frame's occluder and test counts and their cost.
+ * ============================================================================ */
+const occlusion_stats_t& Occlusion_Culler::Get_Stats() const {
+    return stats;
+}
+
+/* ============================================================================
+ * --------------------------- Gather_Occluders
+ * Collects occluder boxes from the chunks within `distance` of the camera:
+ * each vertical run of fully solid LOD_8 mip cells in a chunk becomes one
+ * box. Only the `max_boxes` nearest are kept.
+ *
+ * Chunks are looked up by position over the chunk grid around the camera,
+ * so the cost follows `distance` rather than how much of the world is
+ * loaded.
+ *
+ * ------ Parameters ------
+ * world     : The world holding the chunks
+ * camera    : Camera position
+ * distance  : How far from the camera chunks give occluders
+ * max_boxes : Most boxes to return (0 = no limit)
+ * boxes     : Receives the boxes (cleared first)
+ * ============================================================================ */
+void Occlusion_Culler::Gather_Occluders(
+    World&                          world,
+    const glm::vec3&                camera,
+    float                           distance,
+    int                             max_boxes,
+    std::vector<occluder_box_t>&    boxes
+) {
+    constexpr int CELLS_X = CHUNK_SIZE_X / OCCLUDER_CELL_SIZE;
+    constexpr int CELLS_Y = CHUNK_SIZE_Y / OCCLUDER_CELL_SIZE;
+    constexpr int CELLS_Z = CHUNK_SIZE_Z / OCCLUDER_CELL_SIZE;
+    constexpr int FULL    = OCCLUDER_CELL_SIZE * OCCLUDER_CELL_SIZE * OCCLUDER_CELL_SIZE;
+
+    const glm::vec3  chunk_size = glm::vec3(CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z);
+    const glm::ivec3 lo = glm::ivec3(glm::floor((camera - distance + 0.5f) / chunk_size));
+    const glm::ivec3 hi = glm::ivec3(glm::floor((camera + distance + 0.5f) / chunk_size));
+
+    boxes.clear();
+    for (int cx = lo.x; cx <= hi.x; ++cx) {
+        for (int cz = lo.z; cz <= hi.z; ++cz) {
+            for (int cy = std::max(lo.y, MIN_ID_C_Y); cy <= std::min(hi.y, MAX_ID_C_Y); ++cy) {
+                const glm::ivec3 corner(cx * CHUNK_SIZE_X, cy * CHUNK_SIZE_Y, cz * CHUNK_SIZE_Z);
+
+                glm::vec3 chunk_min, chunk_max;
+                Chunk_Box(corner, chunk_min, chunk_max);
+                if (glm::length(camera - glm::clamp(camera, chunk_min, chunk_max)) > distance) continue;
+
+                Chunk* chunk = world.Get_Chunk(corner, rel_loc_t::WORLD_LOC);
+                if (!chunk) continue;
+
+                const Chunk_Mip& mip = chunk->Get_Mip();
+                if (mip.Get_Solid_Count() < FULL) continue;
+
+                for (int x = 0; x < CELLS_X; ++x) {
+                    for (int z = 0; z < CELLS_Z; ++z) {
+                        int run_start = -1;
+                        for (int y = 0; y <= CELLS_Y; ++y) {
+                            const bool full = y < CELLS_Y && mip.Get_Cell(
+                                { x * OCCLUDER_CELL_SIZE, y * OCCLUDER_CELL_SIZE, z * OCCLUDER_CELL_SIZE },
+                                OCCLUDER_CELL_SIZE
+                            ).count == FULL;
+
+                            if (full && run_start < 0) run_start = y;
+                            if (full || run_start < 0) continue;
+
+                            const glm::vec3 box_min = chunk_min + glm::vec3(x, run_start, z) * static_cast<float>(OCCLUDER_CELL_SIZE);
+                            const glm::vec3 box_max = box_min + glm::vec3(1, y - run_start, 1) * static_cast<float>(OCCLUDER_CELL_SIZE);
+                            boxes.push_back({ box_min, box_max });
+                            run_start = -1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (max_boxes > 0 && boxes.size() > static_cast<size_t>(max_boxes)) {
+        auto dist = [&](const occluder_box_t& box) {
+            return glm::length(camera - glm::clamp(camera, box.box_min, box.box_max));
+        };
+        std::nth_element(boxes.begin(), boxes.begin() + max_boxes, boxes.end(),
+            [&](const occluder_box_t& a, const occluder_box_t& b) { return dist(a) < dist(b); });
+        boxes.resize(static_cast<size_t>(max_boxes));
+    }
+}
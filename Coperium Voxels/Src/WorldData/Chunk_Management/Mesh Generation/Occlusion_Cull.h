@@ -0,0 +1,91 @@
+#pragma once
+#ifndef OCCLUSION_CULL_H
+#define OCCLUSION_CULL_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <array>
+#include <chrono>
+#include <vector>
+#include <GLM/glm.hpp>
+
+#include "../../World.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int OCCLUSION_WIDTH       = 256;  // Depth buffer size in pixels
+constexpr int OCCLUSION_HEIGHT      = 128;
+constexpr int OCCLUSION_LEVELS      = 9;    // 256 x 128 down to 1 x 1
+constexpr int OCCLUDER_CELL_SIZE    = 8;    // Fully solid LOD_8 mip cells become occluders
+
+static_assert((OCCLUSION_WIDTH >> (OCCLUSION_LEVELS - 1)) == 1,
+              "The depth pyramid must end at a single pixel");
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: occluder_box_t                           //
+//----------------------------------------------------------------------------//
+typedef struct occluder_box_t {
+    glm::vec3   box_min = glm::vec3(0.0f);
+    glm::vec3   box_max = glm::vec3(0.0f);
+} occluder_box_t;
+
+//----------------------------------------------------------------------------//
+//                          STRUCT: occlusion_stats_t                         //
+//----------------------------------------------------------------------------//
+typedef struct occlusion_stats_t {
+    int     occluders       = 0;    // Boxes rasterised this frame
+    int     boxes_tested    = 0;    // Chunk boxes tested against the pyramid
+    int     boxes_occluded  = 0;    // Of those, found hidden
+    double  build_ms        = 0.0;  // Gathering, rasterising and the pyramid
+    double  test_ms         = 0.0;  // Spent in Is_Occluded
+} occlusion_stats_t;
+
+//----------------------------------------------------------------------------//
+//                          CLASS: Occlusion_Culler                           //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Hierarchical Z occlusion culling done entirely on the CPU.
+ *
+ * Each frame the nearby solid parts of the world (vertical runs of fully
+ * solid LOD_8 mip cells) are rasterised into a small depth buffer, face by
+ * face. A pixel is only written when the face covers all of it, and with
+ * the farthest depth the face has over the pixel, so the buffer never
+ * claims more than the occluders really hide. A max depth pyramid is then
+ * built over it, and a box is hidden when every pyramid texel under its
+ * screen rectangle, at the level where that rectangle is about 2 x 2
+ * texels, holds something nearer than the box's nearest point.
+ *
+ * Depths are NDC z (-1 near .. 1 far). Nothing needs GL, so it runs and is
+ * checked headlessly.
+ * ============================================================================ */
+class Occlusion_Culler {
+public:
+    void    Begin           (const glm::mat4& view_projection, const glm::vec3& camera);
+    void    Add_Occluder    (const glm::vec3& box_min, const glm::vec3& box_max);
+    void    Build_Pyramid   ();
+    bool    Is_Occluded     (const glm::vec3& box_min, const glm::vec3& box_max);
+
+    float   Get_Depth       (int x, int y, int level = 0) const;
+    const occlusion_stats_t& Get_Stats() const;
+
+    static void Gather_Occluders(
+        World&                          world,
+        const glm::vec3&                camera,
+        float                           distance,
+        int                             max_boxes,
+        std::vector<occluder_box_t>&    boxes
+    );
+
+private:
+    void    Raster_Face     (const glm::vec3 (&corners)[4]);
+
+    glm::mat4   view_projection = glm::mat4(1.0f);
+    glm::vec3   camera          = glm::vec3(0.0f);
+    std::array<std::vector<float>, OCCLUSION_LEVELS> levels;
+    occlusion_stats_t   stats;
+    std::chrono::steady_clock::time_point build_start;
+};
+
+#endif // !OCCLUSION_CULL_H
@@ -0,0 +1,94 @@
+#include "Remesh_Scheduler.h"
+#include <GLM/gtx/norm.hpp>
+
+/* ============================================================================
+ * --------------------------- Push
+ * Queues a chunk for remeshing.
+ *
+ * ------ Parameters ------
+ * sector   : Sector holding the chunk
+ * chunk    : Chunk location within the sector
+ * priority : Sort key from Compute_Priority (lower is sooner)
+ * ============================================================================ */
+void Remesh_Scheduler::Push(
+    const sector_loc_t& sector,
+    const chunk_loc_t&  chunk,
+    float               priority
+) {
+    queue.push({ priority, sector, chunk });
+}
+
+/* ============================================================================
+ * --------------------------- Pop
+ * Removes and returns the most urgent entry. The queue must not be empty.
+ * ============================================================================ */
+remesh_entry_t Remesh_Scheduler::Pop() {
+    remesh_entry_t top = queue.top();
+    queue.pop();
+    return top;
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every queued entry.
+ * ============================================================================ */
+void Remesh_Scheduler::Clear() {
+    queue = {};
+}
+
+bool Remesh_Scheduler::Empty() const {
+    return queue.empty();
+}
+
+size_t Remesh_Scheduler::Size() const {
+    return queue.size();
+}
+
+/* ============================================================================
+ * --------------------------- Reprioritise
+ * Recomputes every queued entry's priority for a new camera position.
+ * ============================================================================ */
+void Remesh_Scheduler::Reprioritise(
+    const glm::vec3&    camera_pos,
+    const glm::vec3&    camera_front
+) {
+    std::vector<remesh_entry_t> entries;
+    entries.reserve(queue.size());
+    while (!queue.empty()) {
+        entries.push_back(queue.top());
+        queue.pop();
+    }
+
+    for (remesh_entry_t& entry : entries) {
+        entry.priority = Compute_Priority(entry.sector, entry.chunk, camera_pos, camera_front);
+        queue.push(entry);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Compute_Priority
+ * Squared distance from the camera to the chunk centre, scaled up for chunks
+ * behind the camera. A zero camera_front treats every chunk as visible.
+ *
+ * ------ Returns ------
+ * The priority key (lower is sooner)
+ * ============================================================================ */
+float Remesh_Scheduler::Compute_Priority(
+    const sector_loc_t& sector,
+    const chunk_loc_t&  chunk,
+    const glm::vec3&    camera_pos,
+    const glm::vec3&    camera_front
+) {
+    glm::vec3 chunk_centre = glm::vec3(
+        sector.X() * SECTR_SIZE_X + chunk.X() * CHUNK_SIZE_X,
+                                    chunk.Y() * CHUNK_SIZE_Y,
+        sector.Z() * SECTR_SIZE_Z + chunk.Z() * CHUNK_SIZE_Z
+    ) + HALF_CHUNK;
+
+    glm::vec3 to_chunk = chunk_centre - camera_pos;
+    float     dst      = glm::length2(to_chunk);
+
+    return glm::dot(to_chunk, camera_front) < 0.0f
+        ? dst * REMESH_BEHIND_WEIGHT
+        : dst;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#ifndef REMESH_SCHEDULER_H
+#define REMESH_SCHEDULER_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <queue>
+#include <vector>
+#include <functional>
+#include <GLM/glm.hpp>
+
+#include "../../CommonWD.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr float REMESH_BEHIND_WEIGHT = 4.0f;    // Priority scale for chunks behind the camera
+
+//----------------------------------------------------------------------------//
+//                          STRUCT: remesh_entry_t                            //
+//----------------------------------------------------------------------------//
+typedef struct remesh_entry_t {
+    float           priority;   // Lower is sooner
+    sector_loc_t    sector;
+    chunk_loc_t     chunk;
+
+    bool operator>(const remesh_entry_t& other) const {
+        return priority > other.priority;
+    }
+} remesh_entry_t;
+
+//----------------------------------------------------------------------------//
+//                        STRUCT: remesh_stats_t                              //
+//----------------------------------------------------------------------------//
+typedef struct remesh_stats_t {
+    int     chunks_meshed   = 0;    // Chunks rebuilt this frame
+    int     chunks_pending  = 0;    // Chunks left in the queue after the frame
+    double  elapsed_ms      = 0.0;  // Time spent meshing this frame
+    int     voxels_patched  = 0;    // Recolours written in place this frame
+    size_t  bytes_built     = 0;    // Mesh bytes uploaded this frame
+} remesh_stats_t;
+
+//----------------------------------------------------------------------------//
+//                        CLASS: Remesh_Scheduler                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Priority queue of chunks waiting for a new mesh.
+ *
+ * Chunks are ordered by squared distance from the camera to the chunk centre,
+ * with chunks behind the camera pushed back by REMESH_BEHIND_WEIGHT, so the
+ * visible chunks closest to the player are rebuilt first. The queue only
+ * stores locations; the WorldManager resolves them when it pops an entry so
+ * chunks unloaded in the meantime are simply skipped.
+ * ============================================================================ */
+class Remesh_Scheduler {
+public:
+    void            Push        (
+        const sector_loc_t& sector,
+        const chunk_loc_t&  chunk,
+        float               priority
+    );
+    remesh_entry_t  Pop         ();
+    void            Clear       ();
+    bool            Empty       () const;
+    size_t          Size        () const;
+
+    void            Reprioritise(
+        const glm::vec3&    camera_pos,
+        const glm::vec3&    camera_front
+    );
+
+    static float    Compute_Priority(
+        const sector_loc_t& sector,
+        const chunk_loc_t&  chunk,
+        const glm::vec3&    camera_pos,
+        const glm::vec3&    camera_front
+    );
+
+private:
+    std::priority_queue<
+        remesh_entry_t,
+        std::vector<remesh_entry_t>,
+        std::greater<remesh_entry_t>
+    > queue;
+};
+
+#endif // !REMESH_SCHEDULER_H
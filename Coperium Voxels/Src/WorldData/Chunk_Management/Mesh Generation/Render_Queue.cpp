@@ -0,0 +1,141 @@
+#include "Render_Queue.h"
+#include "Mesh_Arena.h"
+
+#include <algorithm>
+
+/* ============================================================================
+ * --------------------------- Ring
+ * Works out which distance ring a box falls in.
+ *
+ * ------ Parameters ------
+ * camera  : Camera position
+ * box_min : Box corner with the lowest coordinates
+ * box_max : Box corner with the highest coordinates
+ *
+ * ------ Returns ------
+ * The ring, 0 when the camera is inside the box
+ * ============================================================================ */
+int Render_Queue::Ring(
+    const glm::vec3&    camera,
+    const glm::vec3&    box_min,
+    const glm::vec3&    box_max
+) {
+    const float distance = glm::length(glm::clamp(camera, box_min, box_max) - camera);
+    return std::min(static_cast<int>(distance / RENDER_QUEUE_RING_SIZE), RENDER_QUEUE_RINGS - 1);
+}
+
+/* ============================================================================
+ * --------------------------- Insert
+ * Adds a chunk to the ring it is in from the last camera position (ring 0
+ * before the first Move_Camera). A chunk already queued only has its
+ * pointer refreshed, in case the world replaced it.
+ *
+ * ------ Parameters ------
+ * sector : Sector holding the chunk
+ * chunk  : The chunk's location in the sector
+ * ptr    : The chunk
+ * ============================================================================ */
+void Render_Queue::Insert(
+    const sector_loc_t&             sector,
+    const chunk_loc_t&              chunk,
+    const std::shared_ptr<Chunk>&   ptr
+) {
+    const uint64_t key = Mesh_Arena::Chunk_Key(sector, chunk);
+    auto found = slots.find(key);
+    if (found != slots.end()) {
+        rings[found->second.ring][found->second.slot].chunk = ptr;
+        return;
+    }
+
+    queued_chunk_t item;
+    item.chunk     = ptr;
+    item.sector    = sector;
+    item.chunk_loc = chunk;
+    item.key       = key;
+    Chunk_Box(Chunk_Origin(sector, chunk), item.box_min, item.box_max);
+
+    const int ring = has_camera ? Ring(camera, item.box_min, item.box_max) : 0;
+    slots[key] = { ring, rings[ring].size() };
+    rings[ring].push_back(std::move(item));
+}
+
+/* ============================================================================
+ * --------------------------- Remove
+ * Takes an unloaded chunk out of its ring.
+ *
+ * ------ Returns ------
+ * false if the chunk was not queued
+ * ============================================================================ */
+bool Render_Queue::Remove(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    auto found = slots.find(Mesh_Arena::Chunk_Key(sector, chunk));
+    if (found == slots.end()) return false;
+
+    const slot_t where = found->second;
+    slots.erase(found);
+    Take(where.ring, where.slot);
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Move_Camera
+ * Records the camera position. Once it has moved RENDER_QUEUE_RERING since
+ * the last pass, every chunk's ring is worked out again and only the ones
+ * that changed are moved.
+ *
+ * ------ Returns ------
+ * The number of chunks moved to another ring
+ * ============================================================================ */
+int Render_Queue::Move_Camera(const glm::vec3& camera) {
+    this->camera = camera;
+    if (has_camera && glm::length(camera - ringed_at) < RENDER_QUEUE_RERING) return 0;
+    ringed_at  = camera;
+    has_camera = true;
+
+    int moved = 0;
+    for (int ring = 0; ring < RENDER_QUEUE_RINGS; ++ring) {
+        // Backwards, so the entry swapped into a freed slot was already seen
+        for (size_t slot = rings[ring].size(); slot-- > 0;) {
+            queued_chunk_t& item = rings[ring][slot];
+            const int now = Ring(camera, item.box_min, item.box_max);
+            if (now == ring) continue;
+
+            slots[item.key] = { now, rings[now].size() };
+            rings[now].push_back(std::move(item));
+            Take(ring, slot);
+            ++moved;
+        }
+    }
+    return moved;
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Empties every ring, keeping their storage.
+ * ============================================================================ */
+void Render_Queue::Clear() {
+    for (std::vector<queued_chunk_t>& ring : rings) ring.clear();
+    slots.clear();
+    has_camera = false;
+}
+
+int Render_Queue::Size() const {
+    return static_cast<int>(slots.size());
+}
+
+const std::vector<queued_chunk_t>& Render_Queue::Get_Ring(int ring) const {
+    return rings[ring];
+}
+
+/* ============================================================================
+ * --------------------------- Take
+ * Removes a slot from a ring by moving the ring's last entry into it. The
+ * caller has already dropped or updated the taken entry's slot record.
+ * ============================================================================ */
+void Render_Queue::Take(int ring, size_t slot) {
+    std::vector<queued_chunk_t>& bucket = rings[ring];
+    if (slot + 1 != bucket.size()) {
+        bucket[slot] = std::move(bucket.back());
+        slots[bucket[slot].key].slot = slot;
+    }
+    bucket.pop_back();
+}
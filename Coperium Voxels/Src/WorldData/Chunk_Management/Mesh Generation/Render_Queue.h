@@ -0,0 +1,104 @@
+#pragma once
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <GLFW/glfw3.h>
+#include <GLM/glm.hpp>
+
+#include "../../World.h"
+#include "../../../Compact Data/Cube Mesh/CCMS.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int   RENDER_QUEUE_RINGS      = 64;                   // Last ring takes everything further
+constexpr float RENDER_QUEUE_RING_SIZE  = float(CHUNK_SIZE_X);  // Width of a ring in blocks
+constexpr float RENDER_QUEUE_RERING     = RENDER_QUEUE_RING_SIZE * 0.5f; // Camera travel before rings are redone
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: queued_chunk_t                           //
+//----------------------------------------------------------------------------//
+// One loaded chunk in its distance ring
+typedef struct queued_chunk_t {
+    std::shared_ptr<Chunk>  chunk;
+    sector_loc_t            sector;
+    chunk_loc_t             chunk_loc;
+    uint64_t                key     = 0;    // Mesh_Arena::Chunk_Key
+    glm::vec3               box_min = glm::vec3(0.0f);
+    glm::vec3               box_max = glm::vec3(0.0f);
+} queued_chunk_t;
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: section_draw_t                           //
+//----------------------------------------------------------------------------//
+// One visible chunk section, collected by Render before anything is drawn
+typedef struct section_draw_t {
+    Chunk*          chunk       = nullptr;
+    sector_loc_t    sector;
+    chunk_loc_t     chunk_loc;
+    int             section     = 0;
+    cube_faces_t    directions  = ALL_FACES;
+    GLuint          draw        = 0;    // Index of the chunk's origin in Chunk_Offsets
+} section_draw_t;
+
+//----------------------------------------------------------------------------//
+//                            CLASS: Render_Queue                             //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Every loaded chunk, bucketed by distance ring so Render can read them
+ * roughly front to back and the depth test rejects more of what lies
+ * behind them.
+ *
+ * A ring is RENDER_QUEUE_RING_SIZE blocks of distance from the camera to
+ * the nearest point of the chunk's box. The buckets are kept between
+ * frames: chunks are inserted when they load (or change) and removed when
+ * they unload, and Move_Camera only moves the chunks whose ring changed,
+ * once the camera has travelled RENDER_QUEUE_RERING since the last pass.
+ * Order inside a ring is not kept.
+ *
+ * Entries hold the chunk until Remove takes them out. Unload_Chunk is the
+ * only way a chunk leaves the world and it always calls Remove, so the
+ * queue never decides on its own that a chunk has gone.
+ * ============================================================================ */
+class Render_Queue {
+public:
+    static int Ring(
+        const glm::vec3&    camera,
+        const glm::vec3&    box_min,
+        const glm::vec3&    box_max
+    );
+
+    void    Insert      (
+        const sector_loc_t&             sector,
+        const chunk_loc_t&              chunk,
+        const std::shared_ptr<Chunk>&   ptr
+    );
+    bool    Remove      (const sector_loc_t& sector, const chunk_loc_t& chunk);
+    int     Move_Camera (const glm::vec3& camera);
+    void    Clear       ();
+    int     Size        () const;
+
+    const std::vector<queued_chunk_t>& Get_Ring(int ring) const;
+
+private:
+    void    Take        (int ring, size_t slot);
+
+    typedef struct slot_t {
+        int     ring = 0;
+        size_t  slot = 0;
+    } slot_t;
+
+    std::vector<queued_chunk_t>         rings[RENDER_QUEUE_RINGS];
+    std::unordered_map<uint64_t, slot_t> slots;
+    glm::vec3   camera      = glm::vec3(0.0f);
+    glm::vec3   ringed_at   = glm::vec3(0.0f);  // Camera at the last full pass
+    bool        has_camera  = false;
+};
+
+#endif // !RENDER_QUEUE_H
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef SECTION_MESH_H
+#define SECTION_MESH_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <COIL/Mesh/Basic_Mesh.h>
+
+#include "Face_Patch.h"
+#include "Face_Ranges.h"
+
+//----------------------------------------------------------------------------//
+//                          STRUCT: section_mesh_t                            //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One built section mesh and the maps that go with it. A chunk section
+ * holds two, the one drawn and the one being built, and the LOD mesh cache
+ * holds them for parked chunks.
+ * ============================================================================ */
+typedef struct section_mesh_t {
+    Coil::Basic_Mesh        mesh;
+    int                     num_faces   = 0;        // Faces in the mesh
+    face_slots_t            face_slots;             // Voxel to face range map of the mesh
+    bool                    patchable   = false;    // Mesh can be patched in place
+    face_ranges_t           face_ranges;            // Per direction face ranges of the mesh
+    std::vector<uint16_t>   face_order;             // Slot map face index to grouped face index
+} section_mesh_t;
+
+/* ============================================================================
+ * --------------------------- Swap_Section_Mesh
+ * Swaps two section meshes and their maps without touching the GL objects.
+ * ============================================================================ */
+static inline void Swap_Section_Mesh(section_mesh_t& a, section_mesh_t& b) {
+    a.mesh.Swap(b.mesh);
+    std::swap(a.num_faces  , b.num_faces  );
+    std::swap(a.face_slots , b.face_slots );
+    std::swap(a.patchable  , b.patchable  );
+    std::swap(a.face_ranges, b.face_ranges);
+    std::swap(a.face_order , b.face_order );
+}
+
+/* ============================================================================
+ * --------------------------- Clear_Section_Mesh
+ * Frees a section mesh and empties its maps.
+ * ============================================================================ */
+static inline void Clear_Section_Mesh(section_mesh_t& section) {
+    section.mesh.Clear_Mesh();
+    section.num_faces = 0;
+    section.face_slots.clear();
+    section.patchable = false;
+    section.face_ranges = face_ranges_t();
+    section.face_order.clear();
+}
+
+#endif // !SECTION_MESH_H
@@ -0,0 +1,205 @@
+#include "Chunk_Mesh.h"
+#include "Chunk_Offsets.h"
+#include "Mesh_Arena.h"
+#include "Mesh_Cache.h"
+
+/* ============================================================================
+ * --------------------------- Upload_Packed_Vertex_Mesh
+ * Uploads 4 packed vertices per face and points the mesh at the shared quad
+ * index buffer, growing that buffer first if this chunk needs more quads
+ * than it currently covers.
+ * ============================================================================ */
+static void Upload_Packed_Vertex_Mesh(
+    Coil::Basic_Mesh&           mesh,
+    const std::vector<GLfloat>& vertex_mesh,
+    int                         num_faces,
+    Coil::Quad_Index_Buffer&    quad_indices
+) {
+    quad_indices.Reserve(static_cast<GLsizei>(num_faces));
+
+    mesh.Configure_Mesh(
+        vertex_mesh.data(),
+        sizeof(GLfloat),
+        static_cast<GLsizei>(vertex_mesh.size()),
+        GL_FLOAT,
+        FACE_NUM_ELEMENTS
+    );
+    mesh.Use_Shared_Index_Buffer(
+        quad_indices.Get_EBO(),
+        static_cast<GLsizei>(num_faces) * Coil::Quad_Index_Buffer::INDICES_PER_QUAD
+    );
+
+    mesh.Add_Vertex_Set(0, 1, 0);
+    mesh.Add_Vertex_Set(1, 1, 1);
+    mesh.Add_Vertex_Set(2, 1, 2);
+}
+
+/* ============================================================================
+ * --------------------------- Upload_Packed_Face_Mesh
+ * Uploads one CFD record per face as a per-instance uvec2 attribute. Each
+ * instance draws 6 vertices which face.vert builds from gl_VertexID.
+ * ============================================================================ */
+static void Upload_Packed_Face_Mesh(
+    Coil::Basic_Mesh&           mesh,
+    const std::vector<GLuint>&  face_mesh,
+    int                         num_faces
+) {
+    mesh.Configure_Mesh(
+        face_mesh.data(),
+        sizeof(GLuint),
+        static_cast<GLsizei>(face_mesh.size()),
+        GL_UNSIGNED_INT,
+        CFD::WORDS_PER_FACE
+    );
+    mesh.Add_Instanced_Integer_Set(0, CFD::WORDS_PER_FACE, 0);
+    mesh.Set_Instanced_Draw(CFD::VERTICES_PER_FACE, static_cast<GLsizei>(num_faces));
+}
+
+/* ============================================================================
+ * --------------------------- Upload_Mesh_Data
+ * Clears a mesh and uploads already built faces into it in the context's
+ * format. Nothing is created for zero faces.
+ *
+ * ------ Parameters ------
+ * mesh         : Mesh to fill.
+ * vertex_mesh  : Faces in the PACKED_VERTEX format.
+ * face_mesh    : Faces in the PACKED_FACE format.
+ * num_faces    : Number of faces in whichever of the two is used.
+ * ctx          : Mesh format and shared resources owned by the renderer.
+ * ============================================================================ */
+void Upload_Mesh_Data(
+    Coil::Basic_Mesh&           mesh,
+    const std::vector<GLfloat>& vertex_mesh,
+    const std::vector<GLuint>&  face_mesh,
+    int                         num_faces,
+    const mesh_gen_ctx_t&       ctx
+) {
+    mesh.Clear_Mesh();
+    if (num_faces <= 0) return;
+
+    if (ctx.format == mesh_format_t::PACKED_FACE) {
+        Upload_Packed_Face_Mesh(mesh, face_mesh, num_faces);
+    }
+    else {
+        Upload_Packed_Vertex_Mesh(mesh, vertex_mesh, num_faces, *ctx.quad_indices);
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Upload_Chunk_Mesh
+ * Uploads the data just built in the scratch arena into one section's back
+ * mesh, in whichever format the context asks for; the front mesh is still
+ * drawn until Finish_Chunk_Build swaps it out. Empty sections get no
+ * GL objects at all. The build's face slot map goes with the mesh so
+ * later recolours can be patched in place. If the context has a capture
+ * target the section is also copied there for the mesh cache, in mesher
+ * order, before the faces are grouped by direction for upload so the
+ * renderer can skip directions that face away from the camera. A context
+ * with `upload` off stops there, without touching GL or the chunk.
+ * With an arena in the context the section is written straight into it,
+ * under its Back_Key, and the back mesh is left empty; only a section the
+ * arena cannot place gets a mesh of its own. PACKED_VERTEX meshes also get the per draw
+ * chunk offset attribute (see Chunk_Offsets.h).
+ *
+ * ------ Parameters ------
+ * chunk        : Chunk whose section is built.
+ * section      : Section index (0 = bottom).
+ * scratch      : Arena holding the built vertex or face data. Its grouped
+ *                buffers are overwritten.
+ * num_faces    : Number of faces that were built.
+ * ctx          : Mesh format and shared resources owned by the renderer.
+ * ============================================================================ */
+void Upload_Chunk_Mesh(
+    Chunk&                      chunk,
+    int                         section,
+    mesh_scratch_t&             scratch,
+    int                         num_faces,
+    const mesh_gen_ctx_t&       ctx
+) {
+    if (ctx.capture) {
+        mesh_cache_section_t& cached = ctx.capture->sections[section];
+        cached.num_faces      = num_faces;
+        cached.has_face_slots = scratch.has_face_slots;
+        cached.face_slots     = scratch.face_slots;
+        cached.vertex_mesh.clear();
+        cached.face_mesh  .clear();
+        if (ctx.format == mesh_format_t::PACKED_FACE) cached.face_mesh   = scratch.face_mesh;
+        else                                          cached.vertex_mesh = scratch.vertex_mesh;
+    }
+
+    scratch.Group_By_Direction(num_faces, ctx.format, ctx.depth_sort);
+    if (!ctx.upload) return;
+
+    section_mesh_t&   back = chunk.Get_Back_Section(section);
+    Coil::Basic_Mesh& mesh = back.mesh;
+    const void* grouped = ctx.format == mesh_format_t::PACKED_FACE
+        ? static_cast<const void*>(scratch.grouped_face  .data())
+        : static_cast<const void*>(scratch.grouped_vertex.data());
+
+    if (ctx.arena && ctx.arena->Upload_Section(
+            Mesh_Arena::Back_Key(Mesh_Arena::Section_Key(ctx.arena_chunk, section)), ctx.format, grouped, num_faces)) {
+        if (ctx.format == mesh_format_t::PACKED_VERTEX) {
+            ctx.quad_indices->Reserve(static_cast<GLsizei>(num_faces));
+        }
+        mesh.Clear_Mesh();
+    }
+    else {
+        Upload_Mesh_Data(mesh, scratch.grouped_vertex, scratch.grouped_face, num_faces, ctx);
+        if (num_faces > 0 && ctx.format == mesh_format_t::PACKED_VERTEX && ctx.chunk_offsets != 0) {
+            mesh.Add_Shared_Instanced_Set(ctx.chunk_offsets, CHUNK_OFFSET_ATTRIB, 3, CHUNK_OFFSET_STRIDE);
+        }
+    }
+
+    back.face_slots  = scratch.face_slots;
+    back.patchable   = scratch.has_face_slots;
+    back.face_ranges = scratch.face_ranges;
+    back.face_order  = scratch.face_order;
+    chunk.Finish_Mesh(section, ctx.format, num_faces);
+}
+
+/* ============================================================================
+ * --------------------------- Finish_Chunk_Build
+ * Ends a chunk's build once every section of it has been built: each
+ * built section is swapped in front of the one it replaces, and with an
+ * arena in the context the back faces take over the section's key. Until
+ * then the chunk keeps drawing its old meshes.
+ *
+ * ------ Parameters ------
+ * chunk        : Chunk being built.
+ * ctx          : The context its sections were uploaded with.
+ *
+ * ------ Returns ------
+ * false while the build still has sections to do.
+ * ============================================================================ */
+bool Finish_Chunk_Build(Chunk& chunk, const mesh_gen_ctx_t& ctx) {
+    if (chunk.Get_Build_Sections() != 0) return false;
+
+    if (ctx.arena) {
+        for (int section = 0; section < NUM_SECTIONS; ++section) {
+            if (!chunk.Is_Back_Ready(section)) continue;
+
+            const uint64_t key = Mesh_Arena::Section_Key(ctx.arena_chunk, section);
+            ctx.arena->Promote_Section(Mesh_Arena::Back_Key(key), key);
+        }
+    }
+    chunk.Swap_Meshes();
+    return true;
+}
+
+/* ============================================================================
+ * --------------------------- Restart_Chunk_Build
+ * Drops a chunk's build in progress (Chunk::Restart_Build) along with the
+ * back faces it had placed in the arena.
+ *
+ * ------ Parameters ------
+ * chunk        : Chunk being built.
+ * ctx          : The context its sections were uploaded with.
+ * ============================================================================ */
+void Restart_Chunk_Build(Chunk& chunk, const mesh_gen_ctx_t& ctx) {
+    if (ctx.arena) {
+        for (int section = 0; section < NUM_SECTIONS; ++section) {
+            ctx.arena->Free_Section(Mesh_Arena::Back_Key(Mesh_Arena::Section_Key(ctx.arena_chunk, section)));
+        }
+    }
+    chunk.Restart_Build();
+}
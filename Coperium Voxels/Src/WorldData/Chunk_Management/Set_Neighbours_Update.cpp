@@ -11,10 +11,49 @@ const Offset offsets[] = {
     {  0,  0,  1 }  // Front
 };
 
+/* ============================================================================
+ * --------------------------- Mark_Neighbour_Dirty
+ * Queues sections of the chunk one step away from a base chunk, wrapping
+ * across sector borders.
+ *
+ * ------ Parameters ------
+ * world:    The world object managing sectors and chunks.
+ * sector:   The sector coordinates (ivec3) for the base chunk.
+ * chunk:    The chunk coordinates (ivec3) within the sector for the base chunk.
+ * off:      Step from the base chunk to the neighbour.
+ * sections: Bit mask of the neighbour's sections to rebuild.
+ * ============================================================================
+ */
+static void Mark_Neighbour_Dirty(
+    World& world, const glm::ivec3& sector, const glm::ivec3& chunk,
+    const Offset& off, int sections
+) {
+    glm::ivec3
+        n_sector_pos = glm::ivec3(0),
+        n_chunk_pos = glm::ivec3(0);
+
+    wrap_chunk_sec_x(
+        sector.x, chunk.x, off.dx, n_sector_pos.x, n_chunk_pos.x
+    );
+    wrap_chunk_sec_y(
+        sector.y, chunk.y, off.dy, n_sector_pos.y, n_chunk_pos.y
+    );
+    wrap_chunk_sec_z(
+        sector.z, chunk.z, off.dz, n_sector_pos.z, n_chunk_pos.z
+    );
+
+    world.Mark_Chunk_Dirty(
+        sector_loc_t::Compact(n_sector_pos), chunk_loc_t::Compact(n_chunk_pos),
+        sections
+    );
+}
+
 /* ============================================================================
  * --------------------------- Set_Neighbours_to_Update
  * Marks the given base chunk and its direct neighbours (left, right, above,
- * below, front, and back) as updated.
+ * below, front, and back) as updated and queues them for remeshing. The
+ * chunk below only rebuilds its top section and the chunk above only its
+ * bottom section, since those are the only ones touching the base chunk.
  * 
  * ------ Parameters ------
  * world:   The world object managing sectors and chunks.
@@ -25,43 +64,74 @@ const Offset offsets[] = {
 void WorldManager::Set_Neighbours_to_Update(
     const glm::ivec3& sector, const glm::ivec3& chunk
 ) {
-    if (
-        Sector* curr_sector =
-        world.Get_Sector(sector, rel_loc_t::SECTOR_LOC)
-        ) {
-        if (
-            Chunk* curr_chunk =
-            curr_sector->Get_Chunk(chunk, rel_loc_t::CHUNK_LOC)
-            ) {
-            curr_chunk->Get_Chunk_Data().updated = true;
-        }
-    }
+    world.Mark_Chunk_Dirty(
+        sector_loc_t::Compact(sector), chunk_loc_t::Compact(chunk)
+    );
 
     for (auto off : offsets) {
-        glm::ivec3
-            n_sector_pos = glm::ivec3(0),
-            n_chunk_pos = glm::ivec3(0);
+        int sections =
+            off.dy < 0 ? 1 << (NUM_SECTIONS - 1) :
+            off.dy > 0 ? 1                       :
+                         ALL_SECTIONS;
+        Mark_Neighbour_Dirty(world, sector, chunk, off, sections);
+    }
+}
 
-        wrap_chunk_sec_x(
-            sector.x, chunk.x, off.dx, n_sector_pos.x, n_chunk_pos.x
-        );
-        wrap_chunk_sec_y(
-            sector.y, chunk.y, off.dy, n_sector_pos.y, n_chunk_pos.y
-        );
-        wrap_chunk_sec_z(
-            sector.z, chunk.z, off.dz, n_sector_pos.z, n_chunk_pos.z
-        );
+/* ============================================================================
+ * --------------------------- Set_Cube
+ * Writes a voxel at a world position and queues only the mesh sections that
+ * can see it: its own section (and the adjacent one on a section boundary),
+ * plus the matching section of any neighbouring chunk it borders.
+ *
+ * ------ Parameters ------
+ * pos:     The world position of the voxel.
+ * data:    The voxel data to write.
+ * ============================================================================
+ */
+void WorldManager::Set_Cube(glm::ivec3 pos, vox_data_t data) {
+    Chunk* chunk = world.Get_Chunk(pos, rel_loc_t::WORLD_LOC);
+    if (!chunk) return;
 
-        if (
-            Sector* n_sector =
-            world.Get_Sector(n_sector_pos, rel_loc_t::SECTOR_LOC)
-            ) {
-            if (
-                Chunk* n_chunk =
-                n_sector->Get_Chunk(n_chunk_pos, rel_loc_t::CHUNK_LOC)
-                ) {
-                n_chunk->Get_Chunk_Data().updated = true;
-            }
-        }
-    }
+    const glm::ivec3 local  = Convert_Loc_2_Offset(pos, rel_loc_t::WORLD_LOC, rel_loc_t::CHUNK_LOC);
+    const glm::ivec3 sector = Convert_Loc_2_ID    (pos, rel_loc_t::WORLD_LOC, rel_loc_t::SECTOR_LOC);
+    const glm::ivec3 c_pos  = Convert_Loc_2_ID    (pos, rel_loc_t::WORLD_LOC, rel_loc_t::CHUNK_LOC);
+
+    chunk->Set_Cube(local, data);
+    world.Mark_Chunk_Dirty(
+        sector_loc_t::Compact(sector), chunk_loc_t::Compact(c_pos),
+        Chunk::Get_Section_Mask(local.y)
+    );
+
+    const int own_section = 1 << (local.y / SECTION_SIZE_Y);
+    if (local.x == MIN_ID_V_X) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[0], own_section);
+    if (local.x == MAX_ID_V_X) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[1], own_section);
+    if (local.y == MIN_ID_V_Y) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[2], 1 << (NUM_SECTIONS - 1));
+    if (local.y == MAX_ID_V_Y) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[3], 1);
+    if (local.z == MIN_ID_V_Z) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[4], own_section);
+    if (local.z == MAX_ID_V_Z) Mark_Neighbour_Dirty(world, sector, c_pos, offsets[5], own_section);
+}
+
+/* ============================================================================
+ * --------------------------- Recolour_Voxel
+ * Changes the colour of a voxel at a world position. The faces of the voxel
+ * stay the same, so instead of remeshing, the change is queued and written
+ * straight into the mesh by Apply_Mesh_Patches on the next mesh pass.
+ *
+ * ------ Parameters ------
+ * pos:     The world position of the voxel.
+ * colour:  The new colour (0-15 per channel).
+ * ============================================================================
+ */
+void WorldManager::Recolour_Voxel(glm::ivec3 pos, glm::ivec3 colour) {
+    Chunk* chunk = world.Get_Chunk(pos, rel_loc_t::WORLD_LOC);
+    if (!chunk) return;
+
+    const glm::ivec3 local  = Convert_Loc_2_Offset(pos, rel_loc_t::WORLD_LOC, rel_loc_t::CHUNK_LOC);
+    const glm::ivec3 sector = Convert_Loc_2_ID    (pos, rel_loc_t::WORLD_LOC, rel_loc_t::SECTOR_LOC);
+    const glm::ivec3 c_pos  = Convert_Loc_2_ID    (pos, rel_loc_t::WORLD_LOC, rel_loc_t::CHUNK_LOC);
+
+    chunk->Recolour_Voxel(local, colour);
+    pending_recolours.push_back({
+        sector_loc_t::Compact(sector), chunk_loc_t::Compact(c_pos), local
+    });
 }
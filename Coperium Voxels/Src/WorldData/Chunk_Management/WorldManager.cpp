@@ -76,6 +76,8 @@ void WorldManager::Initialise(bool load_settings) {
     if (load_settings)          Load_Settings();
     if (settings.mass_load)     Mass_Load();
     if (initialise_callback)    initialise_callback(*this);
+    world.Mark_All_Chunks_Dirty();
+
     unload_threshold =
         settings.chunk_radius * CHUNK_SIZE_X *
         settings.chunk_radius * CHUNK_SIZE_Z;
@@ -84,6 +86,7 @@ void WorldManager::Initialise(bool load_settings) {
 
 void WorldManager::Save_World(){
     Store_All_Chunks();
+    Store_Far_Terrain();
 }
 
 void WorldManager::Mass_Load(){
@@ -92,7 +95,11 @@ void WorldManager::Mass_Load(){
 
 /* ============================================================================
  * --------------------------- Render World
- * Calls the render callback if it has been set and rendering is enabled.
+ * Calls the render callback if it has been set and rendering is enabled,
+ * then draws the visible chunk sections. Far terrain sectors and HLOD
+ * groups stand in for their chunks; the rest are frustum and occlusion
+ * culled and drawn nearest ring first (see Frustum_Cull.h,
+ * Occlusion_Cull.h, Render_Queue.h and Mesh_Arena.h).
  * ============================================================================ */
 void WorldManager::Render(
     Coil::Shader&   shader,
@@ -103,58 +110,283 @@ void WorldManager::Render(
     if (render_callback && settings.render_world) render_callback(*this);
     if (!settings.render_world) return;
     size_t drawn = 0;
-    sectors_t* sectors = world.Get_All_Sectrs();
-    for (sector_pair_t sector_pair : *sectors) {
-        chunks_t* chunks = sector_pair.second->Get_All_Chunks();
-        for (chunk_pair_t chunk_pair : *chunks) {
-
-            glm::vec3 offset = {
-                sector_pair.first.X() * SECTR_SIZE_X + chunk_pair.first.X() * CHUNK_SIZE_X,
-                                                       chunk_pair.first.Y() * CHUNK_SIZE_Y,
-                sector_pair.first.Z() * SECTR_SIZE_Z + chunk_pair.first.Z() * CHUNK_SIZE_Z
-            };
-
-            if (settings.smart_render) {
-                glm::vec3 toChunk = offset - player_position;
-                if (glm::dot(toChunk, player_front) <= 0.0f) {
+    size_t faces = 0;
+
+    int        draw_order[NUM_FACES];
+    const int* order = nullptr;
+    if (settings.depth_sort_faces) {
+        Face_Draw_Order(player_front, draw_order);
+        order = draw_order;
+    }
+
+    size_t terrain = 0;
+    if (settings.use_far_terrain) {
+        terrain = far_terrain.Select(player_position, settings.far_terrain_distance);
+    }
+    auto behind_terrain = [&](const sector_loc_t& sector) {
+        return terrain > 0 && far_terrain.Is_Drawn(sector);
+    };
+
+    size_t groups = 0;
+    if (settings.use_hlod) {
+        groups = hlod_groups.Draw_Far(shader, vertex_offset, player_position, settings.hlod_distance, settings.mesh_format, behind_terrain);
+        faces += hlod_groups.Get_Stats().faces_drawn;
+    }
+
+    cull_stats = cull_stats_t();
+    const bool frustum_cull   = settings.smart_render && view_frustum.valid;
+    const bool occlusion_cull = settings.occlusion_cull && view_frustum.valid;
+
+    if (occlusion_cull) {
+        occlusion_culler.Begin(view_projection, player_position);
+        Occlusion_Culler::Gather_Occluders(
+            world, player_position, settings.occluder_distance, settings.occluder_budget, occluder_scratch
+        );
+        for (const occluder_box_t& box : occluder_scratch) {
+            occlusion_culler.Add_Occluder(box.box_min, box.box_max);
+        }
+        occlusion_culler.Build_Pyramid();
+    }
+
+    // The first frame queues every chunk already loaded; after that chunks
+    // join as they are scheduled and leave as they unload
+    if (!queue_tracked) {
+        render_queue.Clear();
+        for (auto [sector_pos, sector_ptr] : *world.Get_All_Sectrs()) {
+            for (auto [chunk_pos, chunk_ptr] : *sector_ptr->Get_All_Chunks()) {
+                render_queue.Insert(sector_pos, chunk_pos, chunk_ptr);
+            }
+        }
+        queue_tracked = true;
+    }
+    if (settings.front_to_back) render_queue.Move_Camera(player_position);
+
+    chunk_offsets.Begin_Frame();
+    section_scratch.clear();
+    sector_tests.clear();
+
+    // A sector's box spans every chunk height it could hold. Each sector is
+    // tested once, the first time one of its chunks comes up
+    auto test_sector = [&](const sector_loc_t& sector) {
+        for (const auto& [location, test] : sector_tests) {
+            if (location == sector.location) return test;
+        }
+
+        glm::vec3 box_min, box_max;
+        Chunk_Box(
+            glm::vec3(sector.X() * SECTR_SIZE_X, MIN_ID_C_Y * CHUNK_SIZE_Y, sector.Z() * SECTR_SIZE_Z),
+            box_min, box_max,
+            glm::vec3(SECTR_SIZE_X, NUM_CHUNKS_Y * CHUNK_SIZE_Y, SECTR_SIZE_Z)
+        );
+
+        const frustum_test_t test = Test_Frustum_Box(view_frustum, box_min, box_max);
+        ++cull_stats.sectors_tested;
+        if (test == frustum_test_t::OUTSIDE) ++cull_stats.sectors_culled;
+        if (test == frustum_test_t::INSIDE ) ++cull_stats.sectors_inside;
+        sector_tests.emplace_back(sector.location, test);
+        return test;
+    };
+
+    for (int ring = 0; ring < RENDER_QUEUE_RINGS; ++ring) {
+        for (const queued_chunk_t& item : render_queue.Get_Ring(ring)) {
+            Chunk& chunk = *item.chunk;
+            if (behind_terrain(item.sector)) continue;
+
+            // Only chunks built in the active format match the bound shader
+            if (chunk.Get_Chunk_Data().mesh_format != settings.mesh_format) {
+                continue;
+            }
+            if (groups > 0 && hlod_groups.Is_Drawn(item.sector, item.chunk_loc)) {
+                continue;
+            }
+
+            frustum_test_t chunk_test = frustum_test_t::INSIDE;
+            if (frustum_cull) {
+                chunk_test = test_sector(item.sector);
+                if (chunk_test == frustum_test_t::OUTSIDE) continue;
+            }
+            if (chunk_test == frustum_test_t::INTERSECTS) {
+                chunk_test = Test_Frustum_Box(view_frustum, item.box_min, item.box_max);
+                ++cull_stats.chunks_tested;
+                if (chunk_test == frustum_test_t::OUTSIDE) {
+                    ++cull_stats.chunks_culled;
                     continue;
                 }
             }
+            if (occlusion_cull && occlusion_culler.Is_Occluded(item.box_min, item.box_max)) {
+                ++cull_stats.chunks_occluded;
+                continue;
+            }
+
+            // Sections are culled on their own; the chunk's offset is only
+            // added once its first visible section is found
+            const glm::vec3 offset = Chunk_Origin(item.sector, item.chunk_loc);
+            GLuint draw = 0;
+            for (int section = 0; section < NUM_SECTIONS; ++section) {
+                if (chunk.Get_Section_Faces(section) == 0) continue;
+
+                glm::vec3 box_min, box_max;
+                Chunk_Box(
+                    offset + glm::vec3(0.0f, section * SECTION_SIZE_Y, 0.0f), box_min, box_max,
+                    glm::vec3(CHUNK_SIZE_X, SECTION_SIZE_Y, CHUNK_SIZE_Z)
+                );
+
+                if (chunk_test == frustum_test_t::INTERSECTS &&
+                    Test_Frustum_Box(view_frustum, box_min, box_max) == frustum_test_t::OUTSIDE) {
+                    ++cull_stats.sections_culled;
+                    continue;
+                }
+
+                cube_faces_t directions = ALL_FACES;
+                if (settings.direction_culling) {
+                    directions = Visible_Face_Directions(player_position, box_min, box_max);
+                }
 
-            shader.Set_Vec3(vertex_offset, offset);
-            chunk_pair.second->Draw_Mesh();
-            ++drawn;
+                if (draw == 0) {
+                    draw = chunk_offsets.Add(offset);
+                    ++drawn;
+                }
+                section_scratch.push_back({
+                    &chunk, item.sector, item.chunk_loc, section, directions, draw
+                });
+            }
         }
     }
+    cull_stats.chunks_drawn = static_cast<int>(drawn);
+
+    faces += Draw_Sections(shader, vertex_offset, order);
 
     if (drawn != last_no_chunks_drawn && settings.debug) {
-        std::cout << "Chunks drawn this frame: " << drawn << std::endl;
+        std::cout << "Chunks drawn this frame: " << drawn
+                  << " (culled sectors: " << cull_stats.sectors_culled
+                  << ", culled chunks: " << cull_stats.chunks_culled
+                  << ", occluded chunks: " << cull_stats.chunks_occluded
+                  << ", HLOD groups: " << groups
+                  << ", terrain sectors: " << terrain
+                  << ", faces submitted: " << faces << ")" << std::endl;
         last_no_chunks_drawn = static_cast<float>(drawn);
     }
 }
 
+/* ============================================================================
+ * --------------------------- Draw Sections
+ * Draws the sections Render collected, nearest ring first. This frame's chunk
+ * offsets are uploaded first, then vertex_offset is zeroed once since every
+ * chunk draw adds its own offset from the buffer. Arena commands are
+ * appended in the same order, so the multi-draw keeps it too.
+ *
+ * ------ Parameters ------
+ * shader        : The bound chunk shader.
+ * vertex_offset : Location of its vertex_offset uniform.
+ * order         : Face direction order, or nullptr.
+ *
+ * ------ Returns ------
+ * Faces submitted
+ * ============================================================================ */
+size_t WorldManager::Draw_Sections(
+    Coil::Shader&   shader,
+    GLuint          vertex_offset,
+    const int*      order
+) {
+    if (section_scratch.empty()) return 0;
+
+    chunk_offsets.Upload();
+    chunk_offsets.Bind_Texture();
+    shader.Set_Vec3(vertex_offset, glm::vec3(0.0f));
+
+    const bool use_arena = built_mesh_arena;
+    if (use_arena) mesh_arena.Begin_Frame(chunk_offsets.Get_Buffer());
+
+    size_t faces = 0;
+    for (const section_draw_t& item : section_scratch) {
+        const int num_faces = item.chunk->Get_Section_Faces(item.section);
+
+        uint32_t first_face = 0;
+        if (use_arena && mesh_arena.Find_Section(
+                Mesh_Arena::Section_Key(Mesh_Arena::Chunk_Key(item.sector, item.chunk_loc), item.section),
+                first_face)) {
+            faces += mesh_arena.Add_Section(
+                first_face, num_faces,
+                item.chunk->Get_Face_Ranges(item.section),
+                item.directions, order, item.draw
+            );
+            continue;
+        }
+        faces += item.chunk->Draw_Section(item.section, item.directions, order, item.draw);
+    }
+
+    if (use_arena) mesh_arena.Draw(quad_index_buffer.Get_EBO());
+    return faces;
+}
+
+/* ============================================================================
+ * --------------------------- Render Far Terrain
+ * Draws the heightfield grids of the sectors the last Render picked, so it
+ * has to follow Render in the same frame. The terrain shader must be bound
+ * with the same view, projection and an identity model matrix.
+ *
+ * ------ Parameters ------
+ * shader        : The bound terrain shader.
+ * vertex_offset : Location of its vertex_offset uniform.
+ * ============================================================================ */
+void WorldManager::Render_Far_Terrain(
+    Coil::Shader&   shader,
+    GLuint          vertex_offset
+) {
+    if (!settings.render_world || !settings.use_far_terrain) return;
+    far_terrain.Draw(shader, vertex_offset);
+}
+
 
 /* ============================================================================
  * --------------------------- Update World
  * Calls the update callback if it has been set.
  * ============================================================================ */
-void WorldManager::Update(glm::vec3 player_position) {
+void WorldManager::Update(glm::vec3 player_position, glm::vec3 player_front) {
 
     Dynamic_Update_Chunks(player_position);
     if (update_callback) update_callback(*this);
     
-    Generate_Mesh(player_position);
+    Generate_Mesh(player_position, player_front);
     initial_update = false;
 }
 
+/* ============================================================================
+ * --------------------------- Set View
+ * Tells the world about the projection it is drawn with, for
+ * `screen_error_lod`. Until it is called the distance thresholds are used.
+ *
+ * ------ Parameters ------
+ * fov_y_degrees   : Vertical field of view.
+ * viewport_height : Height of the viewport in pixels.
+ * ============================================================================ */
+void WorldManager::Set_View(float fov_y_degrees, int viewport_height) {
+    view_fov    = fov_y_degrees;
+    view_height = viewport_height;
+}
+
+/* ============================================================================
+ * --------------------------- Set View Projection
+ * Gives Render the frustum to cull against for `smart_render`, and the
+ * projection `occlusion_cull` rasterises with. Until it is called nothing
+ * is culled.
+ *
+ * ------ Parameters ------
+ * view_projection : projection * view of the camera drawing this frame.
+ * ============================================================================ */
+void WorldManager::Set_View_Projection(const glm::mat4& view_projection) {
+    this->view_projection = view_projection;
+    view_frustum          = Extract_Frustum(view_projection);
+}
+
 /* ============================================================================
  * --------------------------- Generate Mesh
  * Calls the generate mesh callback if it has been set and auto generation is enabled.
  * ============================================================================ */
-void WorldManager::Generate_Mesh(glm::vec3 player_position) {
+void WorldManager::Generate_Mesh(glm::vec3 player_position, glm::vec3 player_front) {
     if (generate_mesh_callback) generate_mesh_callback(*this);
     if (settings.mesh_changes || initial_update) {
-        Generate_All_Chunk_Meshes(player_position);
+        Generate_All_Chunk_Meshes(player_position, player_front);
     }
 }
 
@@ -197,3 +429,66 @@ void WorldManager::Set_Settings(const world_settings_t& new_settings) {
 World& WorldManager::Get_World() {
     return world;
 }
+
+/* ============================================================================
+ * --------------------------- Get Remesh Stats
+ * Returns how many chunks were remeshed last frame, how many are still
+ * waiting and how long it took.
+ * ============================================================================ */
+const remesh_stats_t& WorldManager::Get_Remesh_Stats() const {
+    return remesh_stats;
+}
+
+/* ============================================================================
+ * --------------------------- Get LOD Cache Stats
+ * Returns how many meshes were swapped back in, parked and evicted, and how
+ * much the parked meshes take up.
+ * ============================================================================ */
+const lod_cache_stats_t& WorldManager::Get_LOD_Cache_Stats() const {
+    return lod_mesh_cache.Get_Stats();
+}
+
+/* ============================================================================
+ * --------------------------- Get HLOD Stats
+ * Returns how many far field groups were rebuilt and drawn last frame and
+ * how many chunks they stood in for.
+ * ============================================================================ */
+const hlod_stats_t& WorldManager::Get_HLOD_Stats() const {
+    return hlod_groups.Get_Stats();
+}
+
+/* ============================================================================
+ * --------------------------- Get Far Terrain Stats
+ * Returns how many heightfield columns were scanned and sectors drawn last
+ * frame, and how many dirty chunks are waiting behind the terrain.
+ * ============================================================================ */
+const far_terrain_stats_t& WorldManager::Get_Far_Terrain_Stats() const {
+    return far_terrain.Get_Stats();
+}
+
+/* ============================================================================
+ * --------------------------- Get Cull Stats
+ * Returns how many sectors, chunks and sections the last Render culled
+ * against the view frustum, and how many chunks it drew.
+ * ============================================================================ */
+const cull_stats_t& WorldManager::Get_Cull_Stats() const {
+    return cull_stats;
+}
+
+/* ============================================================================
+ * --------------------------- Get Occlusion Stats
+ * Returns how many occluders the last Render rasterised, how many chunks it
+ * found hidden and what both cost.
+ * ============================================================================ */
+const occlusion_stats_t& WorldManager::Get_Occlusion_Stats() const {
+    return occlusion_culler.Get_Stats();
+}
+
+/* ============================================================================
+ * --------------------------- Get Mesh Arena Stats
+ * Returns how full the mesh arena is, what was uploaded into it since the
+ * last Render and how many commands its multi-draw held.
+ * ============================================================================ */
+const mesh_arena_stats_t& WorldManager::Get_Mesh_Arena_Stats() const {
+    return mesh_arena.Get_Stats();
+}
@@ -11,7 +11,18 @@
 
 #include "../World.h"
 #include "Mesh Generation/Calc_LOD.h"
+#include "Mesh Generation/Remesh_Scheduler.h"
+#include "Mesh Generation/LOD_Rings.h"
+#include "Mesh Generation/HLOD_Groups.h"
+#include "Mesh Generation/Far_Terrain.h"
+#include "Mesh Generation/Frustum_Cull.h"
+#include "Mesh Generation/Occlusion_Cull.h"
+#include "Mesh Generation/Mesh_Arena.h"
+#include "Mesh Generation/Chunk_Offsets.h"
+#include "Mesh Generation/Render_Queue.h"
+#include "Mesh Generation/Mesh_Cache.h"
 #include <COIL/Shaders/Shader.h>
+#include <COIL/Mesh/Quad_Index_Buffer.h>
 
 //----------------------------------------------------------------------------//
 //                               CONSTANTS & ALIASES                          //
@@ -33,25 +44,50 @@ typedef struct world_settings_t {
     bool render_world           = true;   // Enable world rendering
     bool mesh_changes           = true;   // Allow chunk mesh updates
     int  update_interval_ms     = 500;    // Minimum ms between mesh updates
+    mesh_format_t mesh_format   = mesh_format_t::PACKED_VERTEX; // Chunk mesh layout
+    float remesh_budget_ms      = 4.0f;   // Per-frame mesh build budget (0 = no limit)
+    int   remesh_budget_bytes   = 0;      // Per-frame mesh upload budget (0 = no limit)
+    bool  two_pass_mesh         = true;   // Count faces first, then build into exact size buffers
+    bool  use_mesh_cache        = false;  // Reuse meshes saved next to the chunk files (needs allow_chunk_store)
+    bool  direction_culling     = true;   // Skip face directions turned away from the camera
+    bool  depth_sort_faces      = true;   // Near to far faces, directions drawn by view
+    bool  use_mesh_arena        = false;  // Chunk sections kept in one buffer, drawn with one multi-draw
+    bool  front_to_back         = true;   // Keep chunks in distance rings as the camera moves, nearest drawn first
 
     //=== Level of Detail (LOD) ===
     bool use_lod                = true;   // Enable LOD-based mesh detail
     bool dynamic_lod            = true;   // Recompute LOD on camera movement
     bool smart_update           = true;   // Skip LOD if camera hasnt moved
+    int  lod_cache_budget_bytes = 64 * 1024 * 1024; // Meshes kept for other LODs (0 = off, unused with use_mesh_arena)
 
     lod_dst_set_t lod_set       = lod_dst_set_t(
                                     50.0f  * 50.0f,     // NORMAL
                                     100.0f * 100.0f,    // LOD_2
                                     200.0f * 200.0f,    // LOD_4
                                     400.0f * 400.0f     // LOD_8
-                                   );                   // Distance thresholds per LOD
+                                   );                   // Distance thresholds (and margins) per LOD
+    bool  screen_error_lod      = false;  // Derive the thresholds from FOV, viewport and lod_pixel_error
+    float lod_pixel_error       = LOD_DEFAULT_PIXEL_ERROR; // Projected LOD cell size allowed (pixels)
+
+    //=== Far Field (HLOD) ===
+    bool  use_hlod              = true;   // Draw far chunks as merged group meshes
+    float hlod_distance         = 600.0f; // Groups further than this replace their chunks
+    float hlod_budget_ms        = 2.0f;   // Per-frame group rebuild budget (0 = no limit)
+
+    //=== Far Terrain (heightfield) ===
+    bool  use_far_terrain       = true;   // Draw far sectors as heightfield grids
+    float far_terrain_distance  = 1024.0f; // Sectors further than this replace their chunks
+    float far_terrain_budget_ms = 1.0f;   // Per-frame scan / grid rebuild budget (0 = no limit)
 
     //=== World Generation ===
     int  chunk_radius           = 1;      // Radius (in chunks) around player
     Chunk generic_chunk;                  // Prototype chunk for mesh generation
 
     //=== Debug & Development ===
-    bool smart_render           = true;   // Render only visible chunks
+    bool smart_render           = true;   // Frustum cull sectors, chunks and sections
+    bool  occlusion_cull        = false;  // Skip chunks hidden behind nearby solid terrain
+    float occluder_distance     = 96.0f;  // Chunks this close to the camera give occluders
+    int   occluder_budget       = 4096;   // Most occluder boxes rasterised per frame (0 = no limit)
     bool debug                  = false;  // Enable debug logging
 }world_settings_t;
 
@@ -91,8 +127,10 @@ public:
     void Save_World     ();
     void Mass_Load      ();
 
-    void Update         (glm::vec3 player_position);
-    void Generate_Mesh  (glm::vec3 player_position);
+    void Update         (glm::vec3 player_position, glm::vec3 player_front = glm::vec3(0.0f));
+    void Set_View       (float fov_y_degrees, int viewport_height);
+    void Set_View_Projection(const glm::mat4& view_projection);
+    void Generate_Mesh  (glm::vec3 player_position, glm::vec3 player_front = glm::vec3(0.0f));
 
     void Render(
         Coil::Shader&   shader,
@@ -100,6 +138,10 @@ public:
         glm::vec3       player_position,
         glm::vec3       player_front
     );
+    void Render_Far_Terrain(
+        Coil::Shader&   shader,
+        GLuint          vertex_offset
+    );
     //------------------------------------------------------------------------//
     //                         DYNAMIC CHUNK OPERATIONS                       //
     //------------------------------------------------------------------------//
@@ -111,6 +153,8 @@ public:
         const glm::ivec3& sector, 
         const glm::ivec3& chunk
     );
+    void Set_Cube                   (glm::ivec3 pos, vox_data_t data);
+    void Recolour_Voxel             (glm::ivec3 pos, glm::ivec3 colour);
     //------------------------------------------------------------------------//
     //                             GETTERS / SETTERS                          //
     //------------------------------------------------------------------------//
@@ -122,12 +166,54 @@ public:
 
     World&              Get_World       ();
 
+    const remesh_stats_t& Get_Remesh_Stats() const;
+    const lod_cache_stats_t& Get_LOD_Cache_Stats() const;
+    const hlod_stats_t& Get_HLOD_Stats() const;
+    const far_terrain_stats_t& Get_Far_Terrain_Stats() const;
+    const cull_stats_t& Get_Cull_Stats() const;
+    const occlusion_stats_t& Get_Occlusion_Stats() const;
+    const mesh_arena_stats_t& Get_Mesh_Arena_Stats() const;
+
 private:
     //------------------------------------------------------------------------//
     //                         PRIVATE HELPER FUNCTIONS                       //
     //------------------------------------------------------------------------//
     void    Generate_All_Chunk_Meshes(
-        glm::vec3 player_position
+        glm::vec3 player_position,
+        glm::vec3 player_front
+    );
+    void    Schedule_Updated_Chunks(
+        const glm::vec3&        player_position,
+        const glm::vec3&        player_front
+    );
+    void    Drain_Remesh_Queue  ();
+    void    Update_HLOD_Groups  (
+        const mesh_gen_ctx_t&   ctx,
+        const glm::vec3&        player_position
+    );
+    void    Update_Far_Terrain  (const glm::vec3& player_position);
+    bool    Behind_Far_Terrain  (
+        const sector_loc_t&     sector,
+        const glm::vec3&        player_position
+    ) const;
+    void    Assign_Chunk_LOD    (
+        const sector_loc_t&     sector_loc,
+        const chunk_loc_t&      chunk_loc,
+        Chunk&                  chunk,
+        const glm::vec3&        player_position
+    );
+    int     Apply_Mesh_Patches  ();
+    mesh_gen_ctx_t Mesh_Gen_Context    ();
+    int     Build_Chunk_Mesh    (
+        const sector_pair_t&    sector_pair,
+        const chunk_pair_t&     chunk_pair,
+        const mesh_gen_ctx_t&   ctx,
+        bool*                   from_cache = nullptr
+    );
+    size_t  Draw_Sections       (
+        Coil::Shader&           shader,
+        GLuint                  vertex_offset,
+        const int*              order
     );
 
     void    Load_New_Chunks     (
@@ -146,6 +232,12 @@ private:
         const chunk_pair_t&     chunk_pair
     );
     void    Unload_Far_Chunks   (const glm::ivec3& curr_position);
+    void    Release_Far_Sectors (const glm::vec3& player_position);
+    void    Release_Far_Columns (const glm::vec3& player_position);
+    bool    Release_Far_Chunk   (
+        const sector_pair_t&    sector_pair,
+        const chunk_pair_t&     chunk_pair
+    );
     void    Store_All_Chunks    ();
 
 
@@ -158,6 +250,18 @@ private:
         sector_pair_t sector_pair,
         chunk_pair_t  chunk_pair
     );
+    bool Read_Mesh_Cache(
+        sector_loc_t  sector_location,
+        chunk_loc_t   chunk_location,
+        mesh_cache_t& cache
+    );
+    void Store_Mesh_Cache(
+        sector_loc_t        sector_location,
+        chunk_loc_t         chunk_location,
+        const mesh_cache_t& cache
+    );
+    void Store_Far_Terrain();
+    void Read_Far_Terrain ();
 
     //------------------------------------------------------------------------//
     //                           PRIVATE DATA MEMBERS                         //
@@ -165,6 +269,36 @@ private:
     std::string         world_name;
     world_settings_t    settings;
     World               world;
+    Coil::Quad_Index_Buffer quad_index_buffer;  // Shared by every chunk mesh
+    Remesh_Scheduler    remesh_scheduler;       // Chunks waiting for a new mesh
+    LOD_Rings           lod_rings;              // When each chunk's LOD could next change
+    LOD_Mesh_Cache      lod_mesh_cache;         // Meshes chunks may switch back to
+    bool                lods_tracked = false;   // Every loaded chunk has a ring entry
+    lod_dst_set_t       active_lod_set;         // Thresholds the ring entries were made with
+    float               view_fov     = 0.0f;    // Vertical FOV in degrees (0 = unknown)
+    int                 view_height  = 0;       // Viewport height in pixels (0 = unknown)
+    HLOD_Groups         hlod_groups;            // Merged far field meshes
+    bool                hlods_tracked = false;  // Every loaded chunk's group is known
+    Far_Terrain         far_terrain;            // Heightfields standing in for far sectors
+    bool                terrain_tracked = false; // Every loaded chunk's column is known
+    std::vector<dirty_chunk_t> far_deferred;    // Dirty chunks not meshed behind the terrain
+    glm::vec3           released_at = glm::vec3(0.0f); // Camera at the last Release_Far_Sectors
+    float               released_distance = -1.0f; // far_terrain_distance then (-1 = no pass yet)
+    frustum_t           view_frustum;           // Set by Set_View_Projection
+    glm::mat4           view_projection = glm::mat4(1.0f);
+    Occlusion_Culler    occlusion_culler;       // CPU depth pyramid for occlusion_cull
+    std::vector<occluder_box_t> occluder_scratch; // Reused by Gather_Occluders
+    cull_stats_t        cull_stats;             // Last Render's frustum culling
+    Mesh_Arena          mesh_arena;             // Chunk sections for use_mesh_arena
+    Chunk_Offsets       chunk_offsets;          // Origins of the chunks drawn this frame
+    Render_Queue        render_queue;           // Loaded chunks by distance ring
+    bool                queue_tracked = false;  // Every loaded chunk is in render_queue
+    std::vector<section_draw_t> section_scratch; // This frame's visible sections, in draw order
+    std::vector<std::pair<uint32_t, frustum_test_t>> sector_tests; // This frame's sector frustum tests
+    std::vector<dirty_chunk_t> dirty_scratch;   // Reused when draining dirty chunks
+    remesh_stats_t      remesh_stats;           // Last frame's remesh work
+    std::vector<voxel_recolour_t> pending_recolours; // Patched into meshes next frame
+    face_patch_t        patch_scratch;          // Reused for every recolour patch
 
     // Callbacks storage
     std::function<void(WorldManager&)>            initialise_callback;
@@ -182,6 +316,9 @@ private:
     std::chrono::steady_clock::time_point last_update_time
         = std::chrono::steady_clock::now();
 
+    mesh_format_t built_mesh_format = mesh_format_t::PACKED_VERTEX;
+    bool          built_mesh_arena  = false;   // Chunks were last built into mesh_arena
+
     int   time_acc_ms           = 0;
     bool  initial_update        = true;
     float unload_threshold      = 0;
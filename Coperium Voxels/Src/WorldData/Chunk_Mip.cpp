@@ -0,0 +1,153 @@
+#include "Chunk_Mip.h"
+#include "World.h"
+
+/* ============================================================================
+ * --------------------------- Chunk_Mip
+ * Creates an empty, invalid pyramid. Nothing is computed until Build.
+ * ============================================================================ */
+Chunk_Mip::Chunk_Mip() : cells(), valid(false) {}
+
+/* ============================================================================
+ * --------------------------- Level_Index
+ * Maps an l_o_d (2, 4, 8, 16) to its pyramid level.
+ *
+ * ------ Returns ------
+ * 0..3 for a supported l_o_d, -1 otherwise
+ * ============================================================================ */
+int Chunk_Mip::Level_Index(int l_o_d) {
+    switch (l_o_d) {
+    case  2: return 0;
+    case  4: return 1;
+    case  8: return 2;
+    case 16: return 3;
+    default: return -1;
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Cell_Index
+ * Flat index of the cell holding a chunk local voxel position at a level.
+ * Cells are laid out x-major like voxel_loc_t.
+ * ============================================================================ */
+int Chunk_Mip::Cell_Index(const glm::ivec3& pos, int level) {
+    const int shift = level + 1;
+    const int ny    = CHUNK_SIZE_Y >> shift;
+    const int nz    = CHUNK_SIZE_Z >> shift;
+    return MIP_LEVEL_OFFSET[level] +
+        ((pos.x >> shift) * ny + (pos.y >> shift)) * nz + (pos.z >> shift);
+}
+
+/* ============================================================================
+ * --------------------------- Build
+ * Rebuilds the whole pyramid from the chunk's voxels. Level 0 is filled from
+ * the voxels and every coarser level is summed from the eight cells below it.
+ *
+ * ------ Parameters ------
+ * voxels : The chunk's voxel array (voxel_loc_t ordering)
+ * ============================================================================ */
+void Chunk_Mip::Build(const voxels_t& voxels) {
+    cells.fill(mip_cell_t());
+
+    for (int i = 0; i < static_cast<int>(voxels.size()); ++i) {
+        const Voxel& voxel = voxels[i];
+        if (voxel.IsAir()) continue;
+
+        voxel_loc_t loc = { static_cast<uint16_t>(i) };
+        mip_cell_t& cell = cells[Cell_Index({ loc.X(), loc.Y(), loc.Z() }, 0)];
+        cell.count += 1;
+        cell.r     += voxel.GetR();
+        cell.g     += voxel.GetG();
+        cell.b     += voxel.GetB();
+    }
+
+    for (int level = 1; level < MIP_NUM_LEVELS; ++level) {
+        const int step = 1 << level;    // Voxel size of a cell one level down
+        for (int x = 0; x < CHUNK_SIZE_X; x += step) {
+            for (int y = 0; y < CHUNK_SIZE_Y; y += step) {
+                for (int z = 0; z < CHUNK_SIZE_Z; z += step) {
+                    mip_cell_t& child = cells[Cell_Index({ x, y, z }, level - 1)];
+                    mip_cell_t& parent = cells[Cell_Index({ x, y, z }, level)];
+                    parent.count += child.count;
+                    parent.r     += child.r;
+                    parent.g     += child.g;
+                    parent.b     += child.b;
+                }
+            }
+        }
+    }
+
+    valid = true;
+}
+
+/* ============================================================================
+ * --------------------------- Invalidate / Is_Valid
+ * Marks the pyramid stale so the next LOD mesh rebuilds it.
+ * ============================================================================ */
+void Chunk_Mip::Invalidate() {
+    valid = false;
+}
+
+bool Chunk_Mip::Is_Valid() const {
+    return valid;
+}
+
+/* ============================================================================
+ * --------------------------- Add_Voxel
+ * Adds (sign = 1) or removes (sign = -1) one voxel's contribution from the
+ * cell containing it at every level.
+ * ============================================================================ */
+void Chunk_Mip::Add_Voxel(const glm::ivec3& pos, const Voxel& voxel, int sign) {
+    if (voxel.IsAir()) return;
+
+    for (int level = 0; level < MIP_NUM_LEVELS; ++level) {
+        mip_cell_t& cell = cells[Cell_Index(pos, level)];
+        cell.count = static_cast<uint16_t>(cell.count + sign);
+        cell.r     = static_cast<uint16_t>(cell.r + sign * voxel.GetR());
+        cell.g     = static_cast<uint16_t>(cell.g + sign * voxel.GetG());
+        cell.b     = static_cast<uint16_t>(cell.b + sign * voxel.GetB());
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Apply_Write
+ * Keeps a valid pyramid in step with a single voxel write. Does nothing while
+ * the pyramid is invalid, since Build will pick the write up anyway.
+ *
+ * ------ Parameters ------
+ * pos       : Chunk local position of the written voxel
+ * old_voxel : The voxel before the write
+ * new_voxel : The voxel after the write
+ * ============================================================================ */
+void Chunk_Mip::Apply_Write(
+    const glm::ivec3&   pos,
+    const Voxel&        old_voxel,
+    const Voxel&        new_voxel
+) {
+    if (!valid) return;
+    Add_Voxel(pos, old_voxel, -1);
+    Add_Voxel(pos, new_voxel,  1);
+}
+
+/* ============================================================================
+ * --------------------------- Get_Cell
+ * Returns the cell covering the l_o_d^3 block that contains a position.
+ *
+ * ------ Parameters ------
+ * pos   : Chunk local voxel position
+ * l_o_d : 2, 4, 8 or 16
+ * ============================================================================ */
+const mip_cell_t& Chunk_Mip::Get_Cell(const glm::ivec3& pos, int l_o_d) const {
+    return cells[Cell_Index(pos, Level_Index(l_o_d))];
+}
+
+/* ============================================================================
+ * --------------------------- Get_Solid_Count
+ * Total solid voxels in the chunk, summed from the coarsest level.
+ * ============================================================================ */
+int Chunk_Mip::Get_Solid_Count() const {
+    int total = 0;
+    for (int i = 0; i < MIP_LEVEL_CELLS[MIP_NUM_LEVELS - 1]; ++i) {
+        total += cells[MIP_LEVEL_OFFSET[MIP_NUM_LEVELS - 1] + i].count;
+    }
+    return total;
+}
@@ -0,0 +1,90 @@
+#pragma once
+#ifndef CHUNK_MIP_H
+#define CHUNK_MIP_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <array>
+#include <cstdint>
+#include <GLM/glm.hpp>
+
+#include "CommonWD.h"
+
+//----------------------------------------------------------------------------//
+//                                CONSTANTS                                   //
+//----------------------------------------------------------------------------//
+constexpr int MIP_NUM_LEVELS = 4;   // LOD_2, LOD_4, LOD_8, LOD_16
+
+constexpr int MIP_LEVEL_CELLS[MIP_NUM_LEVELS] = {
+    (CHUNK_SIZE_X /  2) * (CHUNK_SIZE_Y /  2) * (CHUNK_SIZE_Z /  2),   // 2048
+    (CHUNK_SIZE_X /  4) * (CHUNK_SIZE_Y /  4) * (CHUNK_SIZE_Z /  4),   //  256
+    (CHUNK_SIZE_X /  8) * (CHUNK_SIZE_Y /  8) * (CHUNK_SIZE_Z /  8),   //   32
+    (CHUNK_SIZE_X / 16) * (CHUNK_SIZE_Y / 16) * (CHUNK_SIZE_Z / 16)    //    4
+};
+
+constexpr int MIP_LEVEL_OFFSET[MIP_NUM_LEVELS] = {
+    0,
+    MIP_LEVEL_CELLS[0],
+    MIP_LEVEL_CELLS[0] + MIP_LEVEL_CELLS[1],
+    MIP_LEVEL_CELLS[0] + MIP_LEVEL_CELLS[1] + MIP_LEVEL_CELLS[2]
+};
+
+constexpr int MIP_TOTAL_CELLS =
+    MIP_LEVEL_OFFSET[MIP_NUM_LEVELS - 1] + MIP_LEVEL_CELLS[MIP_NUM_LEVELS - 1];
+
+//----------------------------------------------------------------------------//
+//                            STRUCT: mip_cell_t                              //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * One l_o_d^3 block of a chunk: how many of its voxels are solid and the sum
+ * of their 4-bit colour channels. The largest block (16^3 = 4096 voxels at
+ * colour 15) sums to 61440, so every field fits in 16 bits.
+ * ============================================================================ */
+typedef struct mip_cell_t {
+    uint16_t count  = 0;    // Solid voxels in the block
+    uint16_t r      = 0;    // Summed red   of the solid voxels
+    uint16_t g      = 0;    // Summed green of the solid voxels
+    uint16_t b      = 0;    // Summed blue  of the solid voxels
+} mip_cell_t;
+
+//----------------------------------------------------------------------------//
+//                            CLASS: Chunk_Mip                                //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * Occupancy / colour pyramid for a single chunk at LOD 2, 4, 8 and 16.
+ *
+ * The pyramid is built lazily the first time a lower detail mesh asks for it
+ * and from then on is kept in step with every voxel write made through the
+ * Chunk API, so LOD meshing is a single cell lookup per output cube instead
+ * of l_o_d^3 voxel reads. Writes made behind the Chunk's back (raw Voxel
+ * pointers, deserialise) must call Invalidate so it is rebuilt on next use.
+ * ============================================================================ */
+class Chunk_Mip {
+public:
+    Chunk_Mip();
+
+    void    Build       (const voxels_t& voxels);
+    void    Invalidate  ();
+    bool    Is_Valid    () const;
+
+    void    Apply_Write (
+        const glm::ivec3&   pos,
+        const Voxel&        old_voxel,
+        const Voxel&        new_voxel
+    );
+
+    const mip_cell_t& Get_Cell(const glm::ivec3& pos, int l_o_d) const;
+    int               Get_Solid_Count() const;
+
+    static int  Level_Index (int l_o_d);
+
+private:
+    static int  Cell_Index  (const glm::ivec3& pos, int level);
+    void        Add_Voxel   (const glm::ivec3& pos, const Voxel& voxel, int sign);
+
+    std::array<mip_cell_t, MIP_TOTAL_CELLS> cells;
+    bool valid;
+};
+
+#endif // !CHUNK_MIP_H
@@ -38,6 +38,11 @@ typedef enum {
     NORMAL
 }voxel_type_t;
 
+typedef enum class mesh_format_t : int {
+    PACKED_VERTEX   = 0,    // 4 vertices x (CLD, CCD, CND) per face
+    PACKED_FACE     = 1     // 1 CFD record per face, expanded in face.vert
+}mesh_format_t;
+
 
 typedef struct vox_data_t {
     glm::ivec3  position        = glm::ivec3(0);
@@ -50,8 +55,14 @@ typedef struct vox_data_t {
 
 
 typedef struct chunk_data_t {
-    lod_Level_t l_o_d;
-    bool        updated;
+    lod_Level_t     l_o_d;
+    bool            updated;
+    mesh_format_t   mesh_format;    // Layout of the currently uploaded mesh
+    bool            try_mesh_cache = false; // Look for a cached mesh at the next build
+    double          lod_due        = -1.0;  // Camera travel its LOD ring entry is due at (-1 = untracked)
+    lod_Level_t     mesh_lod       = lod_Level_t::UNSET; // LOD the uploaded mesh was built at
+    uint64_t        mesh_key       = 0;     // Mesh_Cache_Key of the uploaded mesh (0 = unknown)
+    uint64_t        mesh_voxels    = 0;     // Hash of the voxels the uploaded mesh was built from
 }chunk_data_t;
 
 typedef struct world_data_t {
@@ -0,0 +1,52 @@
+#include "Dirty_Chunk_Queue.h"
+
+/* ============================================================================
+ * --------------------------- Key
+ * Packs a sector and chunk location into a single 64-bit key.
+ * ============================================================================ */
+uint64_t Dirty_Chunk_Queue::Key(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    return (static_cast<uint64_t>(sector.location) << 16) | chunk.location;
+}
+
+/* ============================================================================
+ * --------------------------- Push
+ * Records a chunk as dirty. Does nothing if it is already queued.
+ *
+ * ------ Parameters ------
+ * sector : Sector holding the chunk
+ * chunk  : Chunk location within the sector
+ * ============================================================================ */
+void Dirty_Chunk_Queue::Push(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    if (!queued.insert(Key(sector, chunk)).second) return;
+    pending.push_back({ sector, chunk });
+}
+
+/* ============================================================================
+ * --------------------------- Drain
+ * Appends every queued chunk to out and empties the queue.
+ *
+ * ------ Parameters ------
+ * out : Receives the dirty chunks in the order they were first marked
+ * ============================================================================ */
+void Dirty_Chunk_Queue::Drain(std::vector<dirty_chunk_t>& out) {
+    out.insert(out.end(), pending.begin(), pending.end());
+    pending.clear();
+    queued .clear();
+}
+
+/* ============================================================================
+ * --------------------------- Clear
+ * Drops every queued chunk.
+ * ============================================================================ */
+void Dirty_Chunk_Queue::Clear() {
+    pending.clear();
+    queued .clear();
+}
+
+size_t Dirty_Chunk_Queue::Size() const {
+    return pending.size();
+}
+
+bool Dirty_Chunk_Queue::Empty() const {
+    return pending.empty();
+}
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef DIRTY_CHUNK_QUEUE_H
+#define DIRTY_CHUNK_QUEUE_H
+
+//----------------------------------------------------------------------------//
+//                                  INCLUDES                                  //
+//----------------------------------------------------------------------------//
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "World Opertions/Location/World_Loc_Data.h"
+
+//----------------------------------------------------------------------------//
+//                           STRUCT: dirty_chunk_t                            //
+//----------------------------------------------------------------------------//
+typedef struct dirty_chunk_t {
+    sector_loc_t    sector;
+    chunk_loc_t     chunk;
+} dirty_chunk_t;
+
+//----------------------------------------------------------------------------//
+//                          CLASS: Dirty_Chunk_Queue                          //
+//----------------------------------------------------------------------------//
+/* ============================================================================
+ * World level list of chunks whose mesh needs rebuilding.
+ *
+ * Anything that sets chunk_data_t::updated goes through World::Mark_Chunk_
+ * Dirty, which also records the chunk here, so the mesher only visits chunks
+ * that actually changed instead of scanning every sector for the flag.
+ * Entries are unique until drained and keep insertion order.
+ * ============================================================================ */
+class Dirty_Chunk_Queue {
+public:
+    void    Push    (const sector_loc_t& sector, const chunk_loc_t& chunk);
+    void    Drain   (std::vector<dirty_chunk_t>& out);
+    void    Clear   ();
+    size_t  Size    () const;
+    bool    Empty   () const;
+
+private:
+    static uint64_t Key(const sector_loc_t& sector, const chunk_loc_t& chunk);
+
+    std::vector<dirty_chunk_t>      pending;
+    std::unordered_set<uint64_t>    queued;     // Keys already in pending
+};
+
+#endif // !DIRTY_CHUNK_QUEUE_H
@@ -6,6 +6,7 @@
 #include <glm/glm.hpp>
 #include "../Safe_Operations.h"
 #include "../World_Constants.h"
+#include "World_Loc_Data.h"
 
 
 typedef enum rel_loc_t {
@@ -124,4 +125,40 @@ inline static glm::ivec3 Convert_Loc_2_Offset(
     return glm::ivec3();
 }
 
+/* ============================================================================
+ * --------------------------- Chunk_Origin
+ * World position of a chunk's first voxel.
+ * ============================================================================
+ */
+inline static glm::ivec3 Chunk_Origin(const sector_loc_t& sector, const chunk_loc_t& chunk) {
+    return glm::ivec3(
+        sector.X() * SECTR_SIZE_X + chunk.X() * CHUNK_SIZE_X,
+                                    chunk.Y() * CHUNK_SIZE_Y,
+        sector.Z() * SECTR_SIZE_Z + chunk.Z() * CHUNK_SIZE_Z
+    );
+}
+
+/* ============================================================================
+ * --------------------------- Chunk_Box
+ * The box the voxel geometry of a chunk (or any block of voxels) fills.
+ * Voxels are centred on their position, so it spans origin - 0.5 to
+ * origin + size - 0.5.
+ *
+ * ------ Parameters ------
+ * origin:  World position of the first voxel.
+ * box_min: Receives the corner with the lowest coordinates.
+ * box_max: Receives the corner with the highest coordinates.
+ * size:    Size in voxels, one chunk by default.
+ * ============================================================================
+ */
+inline static void Chunk_Box(
+    const glm::vec3&    origin,
+    glm::vec3&          box_min,
+    glm::vec3&          box_max,
+    const glm::vec3&    size = glm::vec3(CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z)
+) {
+    box_min = origin - 0.5f;
+    box_max = box_min + size;
+}
+
 #endif // !WORLD_LOCATION_CONVERSION_H
\ No newline at end of file
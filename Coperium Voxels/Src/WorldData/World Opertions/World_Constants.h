@@ -15,6 +15,13 @@ inline constexpr int CHUNK_SIZE_Z = 16;
 
 inline constexpr int MAX_VOX_LOC = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;
 
+/* ---------------------------------
+ * MESH SECTIONS IN A CHUNK         */
+inline constexpr int SECTION_SIZE_Y = 16;
+inline constexpr int NUM_SECTIONS   = CHUNK_SIZE_Y / SECTION_SIZE_Y;   // 4
+inline constexpr int ALL_SECTIONS   = (1 << NUM_SECTIONS) - 1;          // 0xF
+inline constexpr int SECTION_VOXELS = CHUNK_SIZE_X * SECTION_SIZE_Y * CHUNK_SIZE_Z;
+
 /* ---------------------------------
  * MAX ID VALUE OF A SECTOR         */
 inline constexpr int MIN_ID_S_X = -16384;
@@ -253,3 +253,53 @@ sectors_t* World::Get_All_Sectrs() {
     return &sectors;
 }
 
+
+
+/* ============================================================================
+ * --------------------------- Mark_Chunk_Dirty
+ * Flags a chunk's sections for remeshing and records the chunk in the dirty
+ * queue. Does nothing if the chunk is not loaded.
+ *
+ * ------ Parameters ------
+ * sector:   The sector holding the chunk.
+ * chunk:    The chunk location within the sector.
+ * sections: Bit mask of the sections to rebuild (default all).
+ * ============================================================================
+ */
+void World::Mark_Chunk_Dirty(sector_loc_t sector, chunk_loc_t chunk, int sections) {
+    Sector* s = Get_Sector(sector);
+    if (!s) { return; }
+    Chunk* c = s->Get_Chunk(chunk);
+    if (!c) { return; }
+
+    c->Get_Chunk_Data().updated = true;
+    c->Mark_Sections_Dirty(sections);
+    dirty_chunks.Push(sector, chunk);
+}
+
+/* ============================================================================
+ * --------------------------- Mark_All_Chunks_Dirty
+ * Flags every loaded chunk for remeshing. Used after bulk creation (world
+ * generators, mass loads) where chunks are made without going through
+ * Mark_Chunk_Dirty.
+ * ============================================================================
+ */
+void World::Mark_All_Chunks_Dirty() {
+    for (auto [sector_pos, sector_ptr] : sectors) {
+        chunks_t* chunks = sector_ptr->Get_All_Chunks();
+        for (auto [chunk_pos, chunk_ptr] : *chunks) {
+            chunk_ptr->Get_Chunk_Data().updated = true;
+            chunk_ptr->Mark_Sections_Dirty(ALL_SECTIONS);
+            dirty_chunks.Push(sector_pos, chunk_pos);
+        }
+    }
+}
+
+/* ============================================================================
+ * --------------------------- Get_Dirty_Chunks
+ * Retrieves the queue of chunks waiting to be remeshed.
+ * ============================================================================
+ */
+Dirty_Chunk_Queue* World::Get_Dirty_Chunks() {
+    return &dirty_chunks;
+}
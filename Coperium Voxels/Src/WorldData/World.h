@@ -4,6 +4,11 @@
 
 #include <COIL/Mesh/Basic_Mesh.h>
 #include "CommonWD.h"
+#include "Chunk_Mip.h"
+#include "Dirty_Chunk_Queue.h"
+#include "Chunk_Management/Mesh Generation/Face_Patch.h"
+#include "Chunk_Management/Mesh Generation/Face_Ranges.h"
+#include "Chunk_Management/Mesh Generation/LOD_Mesh_Cache.h"
 
 
 class World{
@@ -30,9 +35,14 @@ public:
 
     sectors_t* Get_All_Sectrs ();
 
+    void Mark_Chunk_Dirty       (sector_loc_t sector, chunk_loc_t chunk, int sections = ALL_SECTIONS);
+    void Mark_All_Chunks_Dirty  ();
+    Dirty_Chunk_Queue* Get_Dirty_Chunks();
+
 private:
 
     sectors_t sectors;
+    Dirty_Chunk_Queue dirty_chunks;     // Chunks waiting to be remeshed
 
     world_data_t world_data;
 };
@@ -68,6 +78,13 @@ private:
 };
 
 
+typedef struct chunk_section_t {
+    section_mesh_t      front;              // Drawn and patched
+    section_mesh_t      back;               // Filled by a build, then swapped in
+    bool                back_ready = false; // Back holds this build's mesh
+} chunk_section_t;
+
+
 class Chunk {
 public:
      Chunk();
@@ -85,11 +102,38 @@ public:
 
     voxels_t* Get_All_Voxels();
 
-    Coil::Basic_Mesh& Get_Mesh();
-    void Set_Mesh(const Coil::Basic_Mesh& newMesh);
+    Coil::Basic_Mesh& Get_Mesh(int section);
+    void Set_Mesh(int section, const Coil::Basic_Mesh& newMesh);
+    int  Get_Section_Faces(int section) const;
+    const face_slots_t& Get_Face_Slots(int section) const;
+    bool Is_Section_Patchable(int section) const;
+    const face_ranges_t& Get_Face_Ranges(int section) const;
+    const std::vector<uint16_t>& Get_Face_Order(int section) const;
+    void Exchange_Meshes(section_mesh_t (&parked)[NUM_SECTIONS]);
+    void Clear_Meshes();
+
+    int  Take_Build_Sections(int max_sections);
+    int  Get_Build_Sections() const;
+    section_mesh_t& Get_Back_Section(int section);
+    void Finish_Mesh(int section, mesh_format_t format, int num_faces);
+    bool Is_Back_Ready(int section) const;
+    bool Is_Building() const;
+    mesh_format_t Get_Build_Format() const;
+    int  Swap_Meshes();
+    void Restart_Build();
 
     void Draw_Mesh(); 
+    int  Draw_Section(int section, cube_faces_t faces = ALL_FACES, const int* order = nullptr, GLuint draw = 0);
+
+    void Mark_Sections_Dirty(int sections);
+    int  Get_Dirty_Sections() const;
+    void Clear_Dirty_Sections();
+    static int Get_Section_Mask(int y);
     void Set_Cube(glm::ivec3 pos, vox_data_t data);
+    void Recolour_Voxel(glm::ivec3 pos, glm::ivec3 colour);
+
+    const Chunk_Mip& Get_Mip();
+    void Invalidate_Mip();
 
     chunk_data_t& Get_Chunk_Data();          // Non-const reference
     const chunk_data_t& Get_Chunk_Data() const;    // Const reference
@@ -98,10 +142,15 @@ public:
 
     void serialize  (std::ostream& out  );
     void deserialize(std::istream& in   );
+    uint64_t Hash_Voxels() const;
 private:
-    Coil::Basic_Mesh mesh;
+    chunk_section_t sections[NUM_SECTIONS];  // 16 high mesh sections, bottom up
+    int dirty_sections;                      // Bit per section needing a remesh
+    int build_sections = 0;                  // Bit per section the current build has left to do
+    mesh_format_t build_format = mesh_format_t::PACKED_VERTEX; // Format of the back meshes
     voxels_t voxels;
     chunk_data_t chunk_data;
+    Chunk_Mip mip;              // LOD occupancy / colour pyramid
 };
 
 